@@ -76,6 +76,31 @@ static const char maximum_inference_rate_message[] =
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Enables open-loop load generation with the given arrival process: constant, poisson or trace. "
+    "Requests are started at their arrival times regardless of completion of the previous ones and latency "
+    "is measured from the arrival, so it includes the queueing delay. Requires async API. "
+    "Use -nireq large enough to not limit the number of requests in flight.";
+
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Arrival rate in requests per second for constant and poisson arrival processes. "
+    "The start rate of -rate_sweep.";
+
+/// @brief message for open-loop arrival trace
+static const char arrival_trace_message[] =
+    "Optional. Path to a file with arrival times in milliseconds from the start of the run, one per line. "
+    "Required for trace arrival process.";
+
+/// @brief message for latency SLO
+static const char latency_slo_message[] = "Optional. 99th percentile latency SLO in milliseconds for open-loop runs.";
+
+/// @brief message for arrival rate sweep
+static const char rate_sweep_message[] =
+    "Optional. Searches for the maximum arrival rate meeting -latency_slo with constant or poisson arrival process, "
+    "starting from -arrival_rate. Each rate is measured for -t seconds or -niter iterations.";
+
 static const char batch_size_message[] =
     "Optional. Batch size value. If not specified, the batch size value is determined from "
     "Intermediate Representation.";
@@ -283,6 +308,21 @@ DEFINE_uint64(niter, 0, iterations_count_message);
 /// @brief Time to execute topology in seconds
 DEFINE_uint64(t, 0, execution_time_message);
 
+/// @brief Open-loop arrival process
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Open-loop arrival rate
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
+/// @brief Open-loop arrival trace
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief p99 latency SLO
+DEFINE_double(latency_slo, 0, latency_slo_message);
+
+/// @brief Open-loop arrival rate sweep
+DEFINE_bool(rate_sweep, false, rate_sweep_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint64(b, 0, batch_size_message);
@@ -405,6 +445,11 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -arrival <constant/poisson/trace> " << arrival_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"     " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_trace <path>         " << arrival_trace_message << std::endl;
+    std::cout << "    -latency_slo \"<float>\"      " << latency_slo_message << std::endl;
+    std::cout << "    -rate_sweep                   " << rate_sweep_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
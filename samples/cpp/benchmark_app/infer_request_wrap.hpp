@@ -50,6 +50,12 @@ public:
         _request.start_async();
     }
 
+    /// @brief Starts the request which arrived at the given time, the latency includes the time spent in the queue
+    void start_async(const Time::time_point& arrival_time) {
+        _startTime = arrival_time;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "load_generator.hpp"
+// clang-format on
+
+ArrivalProcess parse_arrival_process(const std::string& name) {
+    if (name == "constant") {
+        return ArrivalProcess::CONSTANT;
+    } else if (name == "poisson") {
+        return ArrivalProcess::POISSON;
+    } else if (name == "trace") {
+        return ArrivalProcess::TRACE;
+    }
+    throw std::logic_error("Incorrect arrival process " + name +
+                           ". Please set -arrival option to `constant`, `poisson` or `trace` value.");
+}
+
+std::string to_string(ArrivalProcess process) {
+    switch (process) {
+    case ArrivalProcess::CONSTANT:
+        return "constant";
+    case ArrivalProcess::POISSON:
+        return "poisson";
+    case ArrivalProcess::TRACE:
+        return "trace";
+    }
+    throw std::invalid_argument("Unknown arrival process");
+}
+
+std::vector<double> read_arrival_trace(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open arrival trace file " + path);
+    }
+    std::vector<double> trace;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        try {
+            trace.push_back(std::stod(line));
+        } catch (const std::exception&) {
+            throw std::logic_error("Incorrect arrival time '" + line + "' in trace file " + path);
+        }
+    }
+    if (trace.empty()) {
+        throw std::logic_error("Arrival trace file " + path + " is empty");
+    }
+    std::sort(trace.begin(), trace.end());
+    return trace;
+}
+
+ArrivalSchedule::ArrivalSchedule(ArrivalProcess process, double rate, std::vector<double> trace, uint32_t seed)
+    : _process(process),
+      _trace(std::move(trace)),
+      _generator(seed),
+      _distribution(rate > 0 ? rate / 1000.0 : 1.0) {
+    if (_process != ArrivalProcess::TRACE && rate <= 0) {
+        throw std::logic_error("Arrival rate should be positive for the " + to_string(_process) + " arrival process");
+    }
+    _interval_ms = _process == ArrivalProcess::TRACE ? 0 : 1000.0 / rate;
+}
+
+bool ArrivalSchedule::next(double& arrival_ms) {
+    switch (_process) {
+    case ArrivalProcess::CONSTANT:
+        arrival_ms = _time_ms;
+        _time_ms += _interval_ms;
+        return true;
+    case ArrivalProcess::POISSON:
+        // exponentially distributed inter-arrival times, the first request arrives at the start
+        arrival_ms = _time_ms;
+        _time_ms += _distribution(_generator);
+        return true;
+    case ArrivalProcess::TRACE:
+        if (_index == _trace.size()) {
+            return false;
+        }
+        arrival_ms = _trace[_index++];
+        return true;
+    }
+    return false;
+}
+
+LatencyHistogram::LatencyHistogram(const std::vector<double>& latencies) {
+    constexpr double buckets_per_octave = 4.0;
+    // the first bucket collects everything below 1 us
+    constexpr double min_bound_ms = 0.001;
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto latency : sorted) {
+        const auto index =
+            latency <= min_bound_ms ? 0.0 : std::ceil(std::log2(latency / min_bound_ms) * buckets_per_octave);
+        const auto bound = min_bound_ms * std::exp2(index / buckets_per_octave);
+        if (buckets.empty() || buckets.back().first < bound) {
+            buckets.emplace_back(bound, 0);
+        }
+        buckets.back().second++;
+    }
+}
+
+OpenLoopMetrics::OpenLoopMetrics(const std::string& arrival,
+                                 double target_rate,
+                                 double throughput,
+                                 uint64_t requests,
+                                 const std::vector<double>& latencies,
+                                 double latency_slo)
+    : arrival(arrival),
+      target_rate(target_rate),
+      throughput(throughput),
+      requests(requests),
+      latency_slo(latency_slo) {
+    if (latencies.empty()) {
+        throw std::logic_error("Open-loop run has not completed any request");
+    }
+    latency_p50 = LatencyMetrics(latencies, "", 50).median_or_percentile;
+    latency_p99 = LatencyMetrics(latencies, "", 99).median_or_percentile;
+    latency_max = *std::max_element(latencies.begin(), latencies.end());
+    slo_met = latency_slo <= 0 || latency_p99 <= latency_slo;
+    histogram = LatencyHistogram(latencies).buckets;
+}
+
+void OpenLoopMetrics::write_to_stream(std::ostream& stream) const {
+    std::ios::fmtflags fmt(stream.flags());
+    stream << arrival << ";" << std::fixed << std::setprecision(2) << target_rate << ";" << throughput << ";"
+           << requests << ";" << latency_p50 << ";" << latency_p99 << ";" << latency_max << ";"
+           << (slo_met ? "yes" : "no");
+    stream.flags(fmt);
+}
+
+void OpenLoopMetrics::write_to_slog() const {
+    slog::info << "Arrival rate " << double_to_string(target_rate) << " req/s (" << arrival
+               << "): throughput " << double_to_string(throughput) << " FPS, latency p50 "
+               << double_to_string(latency_p50) << " ms, p99 " << double_to_string(latency_p99) << " ms, max "
+               << double_to_string(latency_max) << " ms";
+    if (latency_slo > 0) {
+        slog::info << (slo_met ? ", SLO met" : ", SLO violated");
+    }
+    slog::info << slog::endl;
+}
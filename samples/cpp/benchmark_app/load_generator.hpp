@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/latency_metrics.hpp"
+// clang-format on
+
+/// @brief Arrival processes of the open-loop load generation
+enum class ArrivalProcess { CONSTANT, POISSON, TRACE };
+
+ArrivalProcess parse_arrival_process(const std::string& name);
+std::string to_string(ArrivalProcess process);
+
+/// @brief Reads arrival times in milliseconds from the start of the run, one per line
+std::vector<double> read_arrival_trace(const std::string& path);
+
+/// @brief Generates arrival times (milliseconds from the start of the run) of the requests
+class ArrivalSchedule {
+public:
+    /// @param rate requests per second for the constant and poisson processes
+    /// @param trace arrival times for the trace replay
+    ArrivalSchedule(ArrivalProcess process, double rate, std::vector<double> trace = {}, uint32_t seed = 0);
+
+    /// @brief Returns false when the trace is over
+    bool next(double& arrival_ms);
+
+private:
+    ArrivalProcess _process;
+    double _interval_ms = 0;
+    std::vector<double> _trace;
+    size_t _index = 0;
+    double _time_ms = 0;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _distribution;
+};
+
+/// @brief Latency histogram with logarithmic buckets (4 buckets per power of two)
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(const std::vector<double>& latencies);
+
+    /// @brief Non-empty buckets as pairs of the bucket upper bound in milliseconds and the number of requests
+    std::vector<std::pair<double, uint64_t>> buckets;
+};
+
+/// @brief Results of an open-loop run at one arrival rate
+struct OpenLoopMetrics {
+    OpenLoopMetrics() = default;
+    OpenLoopMetrics(const std::string& arrival,
+                    double target_rate,
+                    double throughput,
+                    uint64_t requests,
+                    const std::vector<double>& latencies,
+                    double latency_slo);
+
+    void write_to_stream(std::ostream& stream) const;
+    void write_to_slog() const;
+
+    std::string arrival;
+    double target_rate = 0;
+    double throughput = 0;
+    uint64_t requests = 0;
+    double latency_p50 = 0;
+    double latency_p99 = 0;
+    double latency_max = 0;
+    // 0 if SLO is not set
+    double latency_slo = 0;
+    bool slo_met = true;
+    std::vector<std::pair<double, uint64_t>> histogram;
+};
+
+/**
+ * @brief Finds the maximum arrival rate meeting the p99 latency SLO.
+ * The rate is doubled (or halved) from the start rate until the SLO state changes, then the boundary
+ * is bisected until it is known with 5% precision.
+ * @param measure runs the open-loop benchmark at the given rate
+ * @return the results of all the measured rates in the order of measurement
+ */
+template <typename F>
+std::vector<OpenLoopMetrics> sweep_arrival_rate(double start_rate, const F& measure) {
+    constexpr size_t max_steps = 16;
+    constexpr double precision = 0.05;
+    std::vector<OpenLoopMetrics> points;
+    double good = 0;
+    double bad = 0;
+    double rate = start_rate;
+    for (size_t step = 0; step < max_steps; ++step) {
+        points.push_back(measure(rate));
+        if (points.back().slo_met) {
+            good = rate;
+        } else {
+            bad = rate;
+        }
+        if (bad == 0) {
+            rate = good * 2;
+        } else if (good == 0) {
+            rate = bad / 2;
+        } else if ((bad - good) / bad > precision) {
+            rate = (good + bad) / 2;
+        } else {
+            break;
+        }
+    }
+    return points;
+}
@@ -32,6 +32,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -180,6 +181,29 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error(pcsort_err);
     }
 
+    if (!FLAGS_arrival.empty()) {
+        const auto arrival = parse_arrival_process(FLAGS_arrival);
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop load generation (-arrival option) requires async API.");
+        }
+        if (FLAGS_max_irate > 0) {
+            throw std::logic_error("-max_irate option can't be used with open-loop load generation (-arrival option).");
+        }
+        if (arrival == ArrivalProcess::TRACE && FLAGS_arrival_trace.empty()) {
+            throw std::logic_error("Trace arrival process requires -arrival_trace option.");
+        }
+        if (arrival != ArrivalProcess::TRACE && FLAGS_arrival_rate <= 0) {
+            throw std::logic_error("Constant and poisson arrival processes require positive -arrival_rate option.");
+        }
+        if (FLAGS_rate_sweep && (arrival == ArrivalProcess::TRACE || FLAGS_latency_slo <= 0)) {
+            throw std::logic_error("-rate_sweep option requires constant or poisson arrival process and positive "
+                                   "-latency_slo option.");
+        }
+    } else if (FLAGS_rate_sweep || FLAGS_latency_slo > 0 || FLAGS_arrival_rate > 0 || !FLAGS_arrival_trace.empty()) {
+        throw std::logic_error("-arrival_rate, -arrival_trace, -latency_slo and -rate_sweep options require "
+                               "open-loop load generation (-arrival option).");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -1260,57 +1284,127 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        auto set_request_inputs = [&](const InferReqWrap::Ptr& request, size_t iteration) {
+            if (inferenceOnly) {
+                return;
             }
+            auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+            if (FLAGS_pcseq) {
+                request->set_latency_group_id(iteration % app_inputs_info.size());
+            }
+
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+            }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                request->set_tensor(inputName, data);
+            }
+
+            if (useGpuMem) {
+                auto outputTensors = ::gpu::get_remote_output_tensors(compiledModel, request->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    request->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                 }
+            }
+        };
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+        std::vector<OpenLoopMetrics> openLoopResults;
+        if (FLAGS_arrival.empty()) {
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
                 }
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+                set_request_inputs(inferRequest, iteration);
+
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    inferRequest->start_async();
                 }
+                ++iteration;
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+
+                if (FLAGS_max_irate > 0) {
+                    auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
+                    std::this_thread::sleep_for(
+                        std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
                 }
             }
+        } else {
+            /** Open-loop: requests are started at the arrival times of the given process,
+             * the arrivals waiting for an idle request are queued and the waiting time is counted in latency **/
+            const auto arrival = parse_arrival_process(FLAGS_arrival);
+            const auto trace =
+                arrival == ArrivalProcess::TRACE ? read_arrival_trace(FLAGS_arrival_trace) : std::vector<double>{};
+
+            /** The queue times are not reset between the points of a sweep, so the total execution time,
+             * throughput and latency reported below cover the whole run, the points are reported separately **/
+            auto run_open_loop = [&](double rate) {
+                ArrivalSchedule schedule(arrival, rate, trace);
+                const size_t firstLatency = inferRequestsQueue.get_latencies().size();
+                uint64_t pointIterations = 0;
+                size_t pointFrames = 0;
+                double arrivalMs = 0;
+                double lastArrivalMs = 0;
+                const auto openLoopStartTime = Time::now();
+                while ((niter == 0 || pointIterations < niter) && schedule.next(arrivalMs)) {
+                    if (duration_nanoseconds != 0LL && arrivalMs * 1.0e6 >= duration_nanoseconds) {
+                        break;
+                    }
+                    const auto arrivalTime =
+                        openLoopStartTime + std::chrono::duration_cast<Time::duration>(
+                                                std::chrono::duration<double, std::milli>(arrivalMs));
+                    std::this_thread::sleep_until(arrivalTime);
+
+                    inferRequest = inferRequestsQueue.get_idle_request();
+                    if (!inferRequest) {
+                        OPENVINO_THROW("No idle Infer Requests!");
+                    }
+                    set_request_inputs(inferRequest, iteration);
+                    inferRequest->start_async(arrivalTime);
+                    ++iteration;
+                    ++pointIterations;
+                    processedFramesN += batchSize;
+                    pointFrames += batchSize;
+                    lastArrivalMs = arrivalMs;
+                }
+                inferRequestsQueue.wait_all();
+                const double pointDuration =
+                    std::chrono::duration_cast<ns>(Time::now() - openLoopStartTime).count() * 0.000001;
+                const auto latencies = inferRequestsQueue.get_latencies();
+
+                // the offered rate of a trace is derived from its arrivals
+                const double targetRate =
+                    arrival != ArrivalProcess::TRACE ? rate
+                    : lastArrivalMs > 0              ? 1000.0 * static_cast<double>(pointIterations - 1) / lastArrivalMs
+                                                     : 0;
+                OpenLoopMetrics metrics(FLAGS_arrival,
+                                        targetRate,
+                                        1000.0 * pointFrames / pointDuration,
+                                        pointIterations,
+                                        std::vector<double>(latencies.begin() + firstLatency, latencies.end()),
+                                        FLAGS_latency_slo);
+                metrics.write_to_slog();
+                return metrics;
+            };
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
+            if (FLAGS_rate_sweep) {
+                openLoopResults = sweep_arrival_rate(FLAGS_arrival_rate, run_open_loop);
             } else {
-                inferRequest->start_async();
-            }
-            ++iteration;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
-
-            if (FLAGS_max_irate > 0) {
-                auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
-                std::this_thread::sleep_for(
-                    std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
+                openLoopResults.push_back(run_open_loop(FLAGS_arrival_rate));
             }
         }
 
@@ -1338,6 +1432,15 @@ int main(int argc, char* argv[]) {
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
 
+        const OpenLoopMetrics* maxSloPoint = nullptr;
+        if (FLAGS_rate_sweep) {
+            for (const auto& point : openLoopResults) {
+                if (point.slo_met && (!maxSloPoint || point.target_rate > maxSloPoint->target_rate)) {
+                    maxSloPoint = &point;
+                }
+            }
+        }
+
         if (statistics) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("total execution time (ms)", "execution_time", totalDuration),
@@ -1367,6 +1470,20 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            for (const auto& point : openLoopResults) {
+                statistics->add_parameters(StatisticsReport::Category::OPEN_LOOP_RESULTS,
+                                           {StatisticsVariant("Open-loop results", "open_loop_results", point)});
+            }
+            if (FLAGS_rate_sweep) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("max arrival rate meeting latency SLO",
+                                       "slo_max_arrival_rate",
+                                       maxSloPoint ? maxSloPoint->target_rate : 0.0),
+                     StatisticsVariant("throughput at max arrival rate meeting latency SLO",
+                                       "slo_max_throughput",
+                                       maxSloPoint ? maxSloPoint->throughput : 0.0)});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1445,6 +1562,17 @@ int main(int argc, char* argv[]) {
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (FLAGS_rate_sweep) {
+            if (maxSloPoint) {
+                slog::info << "Max arrival rate meeting p99 latency SLO of " << double_to_string(FLAGS_latency_slo)
+                           << " ms: " << double_to_string(maxSloPoint->target_rate) << " req/s, throughput "
+                           << double_to_string(maxSloPoint->throughput) << " FPS" << slog::endl;
+            } else {
+                slog::warn << "None of the measured arrival rates meets p99 latency SLO of "
+                           << double_to_string(FLAGS_latency_slo) << " ms" << slog::endl;
+            }
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
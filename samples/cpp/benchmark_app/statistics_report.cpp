@@ -26,7 +26,7 @@ void StatisticsReport::dump() {
 
     auto dump_parameters = [&dumper](const Parameters& parameters) {
         for (auto& parameter : parameters) {
-            if (parameter.type != StatisticsVariant::METRICS) {
+            if (parameter.type != StatisticsVariant::METRICS && parameter.type != StatisticsVariant::OPEN_LOOP) {
                 dumper << parameter.csv_name;
             }
             dumper << parameter.to_string();
@@ -67,6 +67,16 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_parameters.count(Category::OPEN_LOOP_RESULTS)) {
+        dumper << "Open-loop results";
+        dumper.endLine();
+        dumper << "Arrival;Target rate;Throughput;Requests;p50;p99;Max;SLO met";
+        dumper.endLine();
+
+        dump_parameters(_parameters.at(Category::OPEN_LOOP_RESULTS));
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -212,6 +222,9 @@ void StatisticsReportJSON::dump() {
     if (_parameters.count(Category::EXECUTION_RESULTS_GROUPPED)) {
         dump_parameters(js["execution_results"], _parameters.at(Category::EXECUTION_RESULTS_GROUPPED));
     }
+    if (_parameters.count(Category::OPEN_LOOP_RESULTS)) {
+        dump_parameters(js["execution_results"], _parameters.at(Category::OPEN_LOOP_RESULTS));
+    }
 
     std::ofstream out_stream(name);
     out_stream << std::setw(4) << js << std::endl;
@@ -328,6 +341,27 @@ static nlohmann::json to_json(const LatencyMetrics& latenct_metrics) {
     return stat;
 }
 
+static nlohmann::json to_json(const OpenLoopMetrics& open_loop_metrics) {
+    nlohmann::json stat;
+    stat["arrival"] = open_loop_metrics.arrival;
+    stat["target_rate"] = open_loop_metrics.target_rate;
+    stat["throughput"] = open_loop_metrics.throughput;
+    stat["requests"] = open_loop_metrics.requests;
+    stat["latency_p50"] = open_loop_metrics.latency_p50;
+    stat["latency_p99"] = open_loop_metrics.latency_p99;
+    stat["latency_max"] = open_loop_metrics.latency_max;
+    if (open_loop_metrics.latency_slo > 0) {
+        stat["latency_slo"] = open_loop_metrics.latency_slo;
+        stat["slo_met"] = open_loop_metrics.slo_met;
+    }
+    auto& histogram = stat["latency_histogram"];
+    histogram = nlohmann::json::array();
+    for (const auto& bucket : open_loop_metrics.histogram) {
+        histogram.push_back({{"upper_bound", bucket.first}, {"count", bucket.second}});
+    }
+    return stat;
+}
+
 std::string StatisticsVariant::to_string() const {
     switch (type) {
     case INT:
@@ -338,11 +372,17 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case OPEN_LOOP: {
+        std::ostringstream str;
+        open_loop_val.write_to_stream(str);
+        return str.str();
+    }
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -367,6 +407,13 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(to_json(metrics_val));
     } break;
+    case OPEN_LOOP: {
+        auto& arr = js[json_name];
+        if (arr.empty()) {
+            arr = nlohmann::json::array();
+        }
+        arr.push_back(to_json(open_loop_val));
+    } break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
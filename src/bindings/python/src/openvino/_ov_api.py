@@ -2,10 +2,15 @@
 # Copyright (C) 2018-2026 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+import asyncio
 import io
+import itertools
+import threading
+import weakref
 from types import TracebackType
 from typing import Any, Union, Optional
-from collections.abc import Iterator
+from collections import deque
+from collections.abc import Callable, Iterator
 from pathlib import Path
 import traceback  # noqa: F811
 
@@ -14,6 +19,7 @@ from openvino._pyopenvino import Model as ModelBase
 from openvino._pyopenvino import Core as CoreBase
 from openvino._pyopenvino import CompiledModel as CompiledModelBase
 from openvino._pyopenvino import AsyncInferQueue as AsyncInferQueueBase
+from openvino._pyopenvino import _CompletionChannel
 from openvino._pyopenvino import Node, Tensor, Type, RTMap, TensorVector
 
 from openvino.utils.data_helpers import (
@@ -113,6 +119,108 @@ class Model(object, metaclass=ModelMeta):
         return self.__model.evaluate(outputs, inputs, context)
 
 
+class _CompletionDispatcher:
+    """Delivers completions of asynchronous requests to the futures of an asyncio event loop.
+
+    Inference threads report completions to the native channel without taking the GIL.
+    The event loop is woken up once per batch of completions, so a single loop can drive
+    thousands of requests in flight. There is one dispatcher per event loop.
+
+    The dispatcher refers to its loop weakly. It is closed when the loop is garbage collected
+    or, for a loop closed earlier, on the next lookup of any dispatcher.
+    """
+
+    _dispatchers: weakref.WeakKeyDictionary = weakref.WeakKeyDictionary()
+
+    def __init__(self, loop: asyncio.AbstractEventLoop) -> None:
+        self.channel = _CompletionChannel()
+        self._loop = weakref.ref(loop)
+        self._handlers: dict[int, Callable[[Optional[str]], None]] = {}
+        self._tokens = itertools.count()
+        self._reader = False
+        try:
+            if self.channel.fileno() < 0:
+                raise NotImplementedError
+            loop.add_reader(self.channel.fileno(), self._on_readable)
+            self._reader = True
+        except NotImplementedError:
+            # Event loops which can't poll descriptors (e.g. ProactorEventLoop) get the batches from a helper thread.
+            # The thread doesn't refer to the dispatcher and stops when the channel is closed.
+            threading.Thread(
+                target=_CompletionDispatcher._wait_completions,
+                args=(self.channel, self._loop, weakref.WeakMethod(self._deliver)),
+                daemon=True,
+            ).start()
+        weakref.finalize(loop, self.channel.close)
+
+    @classmethod
+    def get(cls, loop: asyncio.AbstractEventLoop) -> "_CompletionDispatcher":
+        for closed_loop in [other for other in cls._dispatchers.keys() if other.is_closed()]:
+            cls._dispatchers.pop(closed_loop).close()
+        dispatcher = cls._dispatchers.get(loop)
+        if dispatcher is None:
+            dispatcher = cls._dispatchers[loop] = cls(loop)
+        return dispatcher
+
+    def close(self) -> None:
+        loop = self._loop()
+        if self._reader and loop is not None and not loop.is_closed():
+            loop.remove_reader(self.channel.fileno())
+        self._reader = False
+        self._handlers.clear()
+        self.channel.close()
+
+    def register(self, handler: Callable[[Optional[str]], None]) -> int:
+        token = next(self._tokens)
+        self._handlers[token] = handler
+        return token
+
+    def unregister(self, token: int) -> None:
+        self._handlers.pop(token, None)
+
+    def _on_readable(self) -> None:
+        self._deliver(self.channel.drain())
+
+    @staticmethod
+    def _wait_completions(
+        channel: _CompletionChannel,
+        loop_ref: "weakref.ref[asyncio.AbstractEventLoop]",
+        deliver_ref: "weakref.WeakMethod",
+    ) -> None:
+        while True:
+            completions = channel.drain(block=True)
+            loop, deliver = loop_ref(), deliver_ref()
+            # An empty batch means the channel is closed
+            if not completions or loop is None or deliver is None:
+                return
+            try:
+                loop.call_soon_threadsafe(deliver, completions)
+            except RuntimeError:
+                # The event loop is closed
+                return
+            # Nothing is held while waiting, so the loop and the dispatcher can be collected
+            del loop, deliver
+
+    def _deliver(self, completions: list[tuple[int, Optional[str]]]) -> None:
+        for token, error in completions:
+            handler = self._handlers.pop(token, None)
+            if handler is not None:
+                handler(error)
+
+
+def _complete_future(future: asyncio.Future, error: Optional[str], get_result: Callable[[], Any]) -> None:
+    # The future is already done if the awaiting task was cancelled
+    if future.done():
+        return
+    if error is not None:
+        future.set_exception(RuntimeError(error))
+        return
+    try:
+        future.set_result(get_result())
+    except Exception as e:
+        future.set_exception(e)
+
+
 class InferRequest(_InferRequestWrapper):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
@@ -274,6 +382,58 @@ class InferRequest(_InferRequestWrapper):
             userdata,
         )
 
+    async def infer_async(
+        self,
+        inputs: Any = None,
+        share_inputs: bool = False,
+        share_outputs: bool = False,
+        *,
+        decode_strings: bool = True,
+    ) -> OVDict:
+        """Infers specified input(s) in asynchronous mode and awaits the results.
+
+        Must be awaited from the running asyncio event loop. The event loop is not blocked
+        while the request is running: the completion is delivered to the loop through
+        a single wakeup descriptor shared by all the requests awaited in this loop.
+
+        The callback set by `set_callback` is not called for this inference,
+        it is restored when the inference completes.
+        Calling any method on the `InferRequest` object while the request is running
+        will lead to throwing exceptions.
+
+        The allowed types of `inputs` are the same as for `infer`.
+
+        :param inputs: Data to be set on input tensors.
+        :type inputs: Any, optional
+        :param share_inputs: Enables `share_inputs` mode. See `infer` for details.
+
+                             Default value: False
+        :type share_inputs: bool, optional
+        :param share_outputs: Enables `share_outputs` mode. See `infer` for details.
+
+                              Default value: False
+        :type share_outputs: bool, optional
+        :param decode_strings: Controls decoding outputs of textual based data. See `infer` for details.
+
+                               Default value: True
+        :type decode_strings: bool, optional, keyword-only
+
+        :return: Dictionary of results from output tensors with port/int/str keys.
+        :rtype: OVDict
+        """
+        loop = asyncio.get_running_loop()
+        dispatcher = _CompletionDispatcher.get(loop)
+        future = loop.create_future()
+        token = dispatcher.register(lambda error: _complete_future(future, error, lambda: None))
+        inputs = _data_dispatch(self, inputs, is_shared=share_inputs)
+        try:
+            super()._start_async_notify(inputs if isinstance(inputs, dict) else {0: inputs}, dispatcher.channel, token)
+        except Exception:
+            dispatcher.unregister(token)
+            raise
+        await future
+        return OVDict(super()._get_results(share_outputs, decode_strings))
+
     def get_compiled_model(self) -> "CompiledModel":
         """Gets the compiled model this InferRequest is using.
 
@@ -574,6 +734,141 @@ class AsyncInferQueue(AsyncInferQueueBase):
             userdata,
         )
 
+    def start_async_many(
+        self,
+        inputs: list,
+        userdata: Optional[list] = None,
+    ) -> None:
+        """Run asynchronous inference of a batch of inputs using the available InferRequests from the pool.
+
+        Inputs are bound to the requests without copies (as in `share_inputs` mode of `start_async`)
+        and the requests are started within a single GIL release. The data must not be modified
+        until the completion of the corresponding request.
+
+        Completions are collected without taking the GIL and the callback set by `set_callback`
+        is called for them in bulk on the Python thread which calls `start_async_many`, `start_async`,
+        `get_idle_request_id`, `wait_all` or `process_completed`. A request is returned to the pool
+        after its completion is processed. The callback is not called for a failed request,
+        its error is raised by the following flow control call, e.g. `wait_all`.
+
+        Each item of `inputs` accepts the same types as `inputs` of `start_async`.
+
+        :param inputs: Data to be set on input tensors, one item per request.
+        :type inputs: list[Any]
+        :param userdata: Data that will be passed to a callback, one item per request.
+        :type userdata: list[Any], optional
+        """
+        request = self[0]
+        tensors = []
+        for item in inputs:
+            data = _data_dispatch(request, item, is_shared=True)
+            tensors.append(data if isinstance(data, dict) else {0: data})
+        super().start_async_many(tensors, userdata)
+
+    async def infer_async(
+        self,
+        inputs: Any = None,
+        share_inputs: bool = False,
+        share_outputs: bool = False,
+        *,
+        decode_strings: bool = True,
+    ) -> OVDict:
+        """Infers specified input(s) using the next available InferRequest from the pool and awaits the results.
+
+        Must be awaited from the running asyncio event loop. The event loop is not blocked:
+        if all the requests of the pool are busy, the call waits for any of them to finish.
+        Completions of all the requests are delivered to the loop in batches through a single
+        wakeup descriptor, so the number of concurrently awaited calls is not limited
+        by the size of the pool.
+
+        The callback set by `set_callback` is not called for these requests. The call is not meant to be mixed
+        with `start_async` on the same AsyncInferQueue.
+
+        The allowed types of `inputs` are the same as for `start_async`.
+
+        :param inputs: Data to be set on input tensors of the next available InferRequest.
+        :type inputs: Any, optional
+        :param share_inputs: Enables `share_inputs` mode. See `start_async` for details.
+
+                             Default value: False
+        :type share_inputs: bool, optional
+        :param share_outputs: Enables `share_outputs` mode. Controls memory usage on inference's outputs.
+
+                              If set to `True` the data will be returned in form of views of output Tensors
+                              which are overwritten by the next inference of the same InferRequest.
+
+                              Default value: False
+        :type share_outputs: bool, optional
+        :param decode_strings: Controls decoding outputs of textual based data.
+
+                               If set to `True` string outputs will be returned as numpy arrays of `U` kind.
+
+                               If set to `False` string outputs will be returned as numpy arrays of `S` kind.
+
+                               Default value: True
+        :type decode_strings: bool, optional, keyword-only
+
+        :return: Dictionary of results from output tensors with port/int/str keys.
+        :rtype: OVDict
+        """
+        loop = asyncio.get_running_loop()
+        dispatcher = _CompletionDispatcher.get(loop)
+        handle = await self._acquire_idle_request_id(loop)
+        request = self[handle]
+        future = loop.create_future()
+
+        def on_completion(error: Optional[str]) -> None:
+            # The results are taken before the request is returned to the pool and reused
+            try:
+                _complete_future(future, error, lambda: OVDict(request._get_results(share_outputs, decode_strings)))
+            finally:
+                self._release_idle_request_id(handle)
+
+        token = dispatcher.register(on_completion)
+        inputs = _data_dispatch(request, inputs, is_shared=share_inputs)
+        try:
+            super()._start_async_notify(
+                handle,
+                inputs if isinstance(inputs, dict) else {0: inputs},
+                dispatcher.channel,
+                token,
+            )
+        except Exception:
+            dispatcher.unregister(token)
+            self._release_idle_request_id(handle)
+            raise
+        return await future
+
+    def _idle_waiters(self) -> deque:
+        return self.__dict__.setdefault("_idle_waiters_queue", deque())
+
+    async def _acquire_idle_request_id(self, loop: asyncio.AbstractEventLoop) -> int:
+        handle = super()._try_get_idle_request_id()
+        while handle is None:
+            waiter = loop.create_future()
+            self._idle_waiters().append(waiter)
+            try:
+                await waiter
+            except asyncio.CancelledError:
+                # Pass the wakeup to the next waiter if it was already granted to this one
+                if waiter.done() and not waiter.cancelled():
+                    self._wake_idle_waiter()
+                raise
+            handle = super()._try_get_idle_request_id()
+        return handle
+
+    def _release_idle_request_id(self, handle: int) -> None:
+        super()._release_request_id(handle)
+        self._wake_idle_waiter()
+
+    def _wake_idle_waiter(self) -> None:
+        waiters = self._idle_waiters()
+        while waiters:
+            waiter = waiters.popleft()
+            if not waiter.done():
+                waiter.set_result(None)
+                return
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
@@ -113,6 +113,68 @@ class AsyncInferQueue(openvino._pyopenvino.AsyncInferQueue):
                                       Default value: False
                 :type share_inputs: bool, optional
                 
+        """
+    def start_async_many(self, inputs: list, userdata: typing.Optional[list] = None) -> None:
+        """
+        Run asynchronous inference of a batch of inputs using the available InferRequests from the pool.
+        
+                Inputs are bound to the requests without copies (as in `share_inputs` mode of `start_async`)
+                and the requests are started within a single GIL release. The data must not be modified
+                until the completion of the corresponding request.
+        
+                Completions are collected without taking the GIL and the callback set by `set_callback`
+                is called for them in bulk on the Python thread which calls `start_async_many`, `start_async`,
+                `get_idle_request_id`, `wait_all` or `process_completed`. A request is returned to the pool
+                after its completion is processed.
+        
+                Each item of `inputs` accepts the same types as `inputs` of `start_async`.
+        
+                :param inputs: Data to be set on input tensors, one item per request.
+                :type inputs: list[Any]
+                :param userdata: Data that will be passed to a callback, one item per request.
+                :type userdata: list[Any], optional
+                
+        """
+    async def infer_async(self, inputs: typing.Any = None, share_inputs: bool = False, share_outputs: bool = False, *, decode_strings: bool = True) -> OVDict:
+        """
+        Infers specified input(s) using the next available InferRequest from the pool and awaits the results.
+        
+                Must be awaited from the running asyncio event loop. The event loop is not blocked:
+                if all the requests of the pool are busy, the call waits for any of them to finish.
+                Completions of all the requests are delivered to the loop in batches through a single
+                wakeup descriptor, so the number of concurrently awaited calls is not limited
+                by the size of the pool.
+        
+                The callback set by `set_callback` is not called for these requests. The call is not meant to be mixed
+                with `start_async` on the same AsyncInferQueue.
+        
+                The allowed types of `inputs` are the same as for `start_async`.
+        
+                :param inputs: Data to be set on input tensors of the next available InferRequest.
+                :type inputs: Any, optional
+                :param share_inputs: Enables `share_inputs` mode. See `start_async` for details.
+        
+                                     Default value: False
+                :type share_inputs: bool, optional
+                :param share_outputs: Enables `share_outputs` mode. Controls memory usage on inference's outputs.
+        
+                                      If set to `True` the data will be returned in form of views of output Tensors
+                                      which are overwritten by the next inference of the same InferRequest.
+        
+                                      Default value: False
+                :type share_outputs: bool, optional
+                :param decode_strings: Controls decoding outputs of textual based data.
+        
+                                       If set to `True` string outputs will be returned as numpy arrays of `U` kind.
+        
+                                       If set to `False` string outputs will be returned as numpy arrays of `S` kind.
+        
+                                       Default value: True
+                :type decode_strings: bool, optional, keyword-only
+        
+                :return: Dictionary of results from output tensors with port/int/str keys.
+                :rtype: OVDict
+                
         """
 class CompiledModel(openvino._pyopenvino.CompiledModel):
     """
@@ -442,6 +504,40 @@ class InferRequest(openvino.utils.data_helpers.wrappers._InferRequestWrapper):
                 :return: Dictionary of results from output tensors with port/int/str keys.
                 :rtype: OVDict
                 
+        """
+    async def infer_async(self, inputs: typing.Any = None, share_inputs: bool = False, share_outputs: bool = False, *, decode_strings: bool = True) -> OVDict:
+        """
+        Infers specified input(s) in asynchronous mode and awaits the results.
+        
+                Must be awaited from the running asyncio event loop. The event loop is not blocked
+                while the request is running: the completion is delivered to the loop through
+                a single wakeup descriptor shared by all the requests awaited in this loop.
+        
+                The callback set by `set_callback` is not called for this inference,
+                it is restored when the inference completes.
+                Calling any method on the `InferRequest` object while the request is running
+                will lead to throwing exceptions.
+        
+                The allowed types of `inputs` are the same as for `infer`.
+        
+                :param inputs: Data to be set on input tensors.
+                :type inputs: Any, optional
+                :param share_inputs: Enables `share_inputs` mode. See `infer` for details.
+        
+                                     Default value: False
+                :type share_inputs: bool, optional
+                :param share_outputs: Enables `share_outputs` mode. See `infer` for details.
+        
+                                      Default value: False
+                :type share_outputs: bool, optional
+                :param decode_strings: Controls decoding outputs of textual based data. See `infer` for details.
+        
+                                       Default value: True
+                :type decode_strings: bool, optional, keyword-only
+        
+                :return: Dictionary of results from output tensors with port/int/str keys.
+                :rtype: OVDict
+                
         """
     def start_async(self, inputs: typing.Any = None, userdata: typing.Any = None, share_inputs: bool = False) -> None:
         """
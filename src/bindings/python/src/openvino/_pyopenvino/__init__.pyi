@@ -68,6 +68,14 @@ class AsyncInferQueue:
                     :return: If there is at least one free InferRequest in a pool, returns True.
                     :rtype: bool
         """
+    def process_completed(self) -> int:
+        """
+                    Processes completions of the requests started by `start_async_many`:
+                    calls the callback for each of them and returns the requests to the pool.
+        
+                    :return: Number of processed completions.
+                    :rtype: int
+        """
     def set_callback(self, arg0: collections.abc.Callable) -> None:
         """
                     Sets unified callback on all InferRequests from queue's pool.
@@ -119,6 +127,27 @@ class AsyncInferQueue:
         
                     GIL is released while waiting for the next available InferRequest.
         """
+    def start_async_many(self, inputs: list, userdata: typing.Any = None) -> None:
+        """
+                    Run asynchronous inference of a batch of inputs using the available InferRequests.
+        
+                    Inputs of several requests are bound at once and the requests are started
+                    within a single GIL release. Tensors are bound as is, so the data they share
+                    must not be modified until the completion of the request.
+        
+                    Completions are collected without taking the GIL and are processed in bulk
+                    (the callback set by `set_callback` is called) on the Python thread calling
+                    `start_async_many`, `get_idle_request_id`, `start_async` or `wait_all`.
+                    A request is returned to the pool after its completion is processed.
+        
+                    GIL is released while waiting for the available InferRequests.
+        
+                    :param inputs: Data to set on input tensors of InferRequests, one dict per request.
+                    :type inputs: list[dict[Union[int, str, openvino.ConstOutput] : openvino.Tensor]]
+                    :param userdata: Data passed to a callback, one item per request.
+                    :type userdata: Optional[list[Any]]
+                    :rtype: None
+        """
     def wait_all(self) -> None:
         """
                     One of 'flow control' functions. Blocking call.
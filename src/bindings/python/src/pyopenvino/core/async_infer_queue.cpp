@@ -6,19 +6,79 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <exception>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/core/completion_channel.hpp"
 #include "pyopenvino/core/infer_request.hpp"
 #include "pyopenvino/utils/utils.hpp"
 
 namespace py = pybind11;
 
+// Lock-free multi-producer single-consumer ring of completed requests.
+// A request is pushed once per inference and is not started again until it is popped,
+// so the ring never overflows if its capacity is not less than the number of requests.
+class CompletionRing {
+public:
+    explicit CompletionRing(size_t requests) {
+        size_t capacity = 1;
+        while (capacity < requests) {
+            capacity <<= 1;
+        }
+        m_mask = capacity - 1;
+        m_cells = std::vector<Cell>(capacity);
+    }
+
+    void push(size_t handle, std::exception_ptr exception_ptr) {
+        const auto pos = m_tail.fetch_add(1, std::memory_order_relaxed);
+        auto& cell = m_cells[pos & m_mask];
+        cell.handle = handle;
+        cell.exception_ptr = std::move(exception_ptr);
+        cell.sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    bool empty() const {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        return m_cells[head & m_mask].sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+    // Must not be called concurrently
+    template <typename F>
+    void pop_all(F&& f) {
+        auto head = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[head & m_mask];
+            if (cell.sequence.load(std::memory_order_acquire) != head + 1) {
+                break;
+            }
+            f(cell.handle, std::move(cell.exception_ptr));
+            head++;
+            m_head.store(head, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        size_t handle = 0;
+        std::exception_ptr exception_ptr;
+    };
+
+    std::vector<Cell> m_cells;
+    size_t m_mask = 0;
+    alignas(64) std::atomic<size_t> m_tail{0};
+    alignas(64) std::atomic<size_t> m_head{0};
+};
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
@@ -28,6 +88,9 @@ public:
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
+        m_notifications.resize(jobs);
+        m_batch_inputs.resize(jobs);
+        m_completed = std::make_unique<CompletionRing>(jobs);
 
         for (size_t handle = 0; handle < jobs; handle++) {
             // Create new "empty" InferRequestWrapper without pre-defined callback and
@@ -51,45 +114,226 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
-        return !(m_idle_handles.empty());
+        // Completed requests of start_async_many are returned to the pool by get_idle_request_id
+        return !(m_idle_handles.empty()) || !m_completed->empty();
     }
 
     size_t get_idle_request_id() {
         // Wait for any request to complete and return its id
-        // release GIL to avoid deadlock on python callback
+        while (true) {
+            {
+                // release GIL to avoid deadlock on python callback
+                py::gil_scoped_release release;
+                // acquire the mutex to access m_errors and m_idle_handles
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] {
+                    return !(m_idle_handles.empty()) || !m_completed->empty();
+                });
+                if (!m_idle_handles.empty()) {
+                    size_t idle_handle = m_idle_handles.front();
+                    // the callback of start_async_many request may still need the mutex
+                    lock.unlock();
+                    // wait for request to make sure it returned from callback
+                    m_requests[idle_handle].m_request.wait();
+                    lock.lock();
+                    if (m_errors.size() > 0)
+                        throw m_errors.front();
+                    return idle_handle;
+                }
+            }
+            // Requests of start_async_many are returned to the pool after their completions are processed
+            process_completed();
+        }
+    }
+
+    std::optional<size_t> try_get_idle_request_id() {
+        // Non-blocking version of get_idle_request_id which also takes the request from the idle queue
         py::gil_scoped_release release;
         // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
-        // wait for request to make sure it returned from callback
-        m_requests[idle_handle].m_request.wait();
+        std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
+        if (m_idle_handles.empty())
+            return std::nullopt;
+        size_t idle_handle = m_idle_handles.front();
+        m_idle_handles.pop();
         return idle_handle;
     }
 
+    void release_request_id(size_t handle) {
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle_handles.push(handle);
+        }
+        m_cv.notify_one();
+    }
+
     void wait_all() {
         // Wait for all request to complete
-        // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        for (auto&& request : m_requests) {
-            request.m_request.wait();
+        std::exception_ptr wait_error;
+        {
+            // release GIL to avoid deadlock on python callback
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                try {
+                    request.m_request.wait();
+                } catch (...) {
+                    // the completions of start_async_many requests must be processed anyway
+                    if (!wait_error) {
+                        wait_error = std::current_exception();
+                    }
+                }
+            }
+        }
+        process_completed();
+        {
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_errors.size() > 0)
+                throw m_errors.front();
+        }
+        if (wait_error) {
+            std::rethrow_exception(wait_error);
+        }
+    }
+
+    void start_async_many(const py::list& inputs, const py::object& userdata) {
+        const size_t count = inputs.size();
+        if (!userdata.is_none() && py::len(userdata) != count) {
+            throw py::value_error("Number of userdata items doesn't match the number of inputs");
+        }
+
+        size_t submitted = 0;
+        std::vector<size_t> handles;
+        while (submitted < count) {
+            handles.clear();
+            {
+                // Take as many idle requests as needed at once
+                py::gil_scoped_release release;
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] {
+                    return !(m_idle_handles.empty()) || !m_completed->empty();
+                });
+                if (m_errors.size() > 0)
+                    throw m_errors.front();
+                while (!m_idle_handles.empty() && submitted + handles.size() < count) {
+                    handles.push_back(m_idle_handles.front());
+                    m_idle_handles.pop();
+                }
+            }
+            if (handles.empty()) {
+                // The pool is busy with requests which wait for their completions to be processed
+                process_completed();
+                continue;
+            }
+
+            size_t bound = 0;
+            try {
+                for (; bound < handles.size(); bound++) {
+                    const auto handle = handles[bound];
+                    const auto item = inputs[submitted + bound];
+                    Common::set_request_tensors(m_requests[handle].m_request, item.cast<py::dict>());
+                    m_user_ids[handle] = userdata.is_none() ? py::none() : userdata[py::int_(submitted + bound)];
+                    // Inputs are bound without copies, so the data must outlive the inference
+                    m_batch_inputs[handle] = item;
+                    m_notifications[handle] = {};
+                    m_notifications[handle].batched = true;
+                }
+            } catch (...) {
+                for (size_t i = bound; i < handles.size(); i++) {
+                    release_request_id(handles[i]);
+                }
+                for (size_t i = 0; i < bound; i++) {
+                    m_notifications[handles[i]] = {};
+                    m_batch_inputs[handles[i]] = py::none();
+                    release_request_id(handles[i]);
+                }
+                throw;
+            }
+
+            {
+                // All the requests of the chunk are started within a single GIL release
+                py::gil_scoped_release release;
+                size_t started = 0;
+                try {
+                    for (; started < handles.size(); started++) {
+                        auto& request = m_requests[handles[started]];
+                        // wait for request to make sure it returned from callback
+                        request.m_request.wait();
+                        *request.m_start_time = Time::now();
+                        request.m_request.start_async();
+                    }
+                } catch (...) {
+                    for (size_t i = started; i < handles.size(); i++) {
+                        m_notifications[handles[i]] = {};
+                        release_request_id(handles[i]);
+                    }
+                    throw;
+                }
+            }
+            submitted += handles.size();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+    }
+
+    size_t process_completed() {
+        // Completions of start_async_many requests are processed in bulk on the calling Python thread
+        std::vector<std::pair<size_t, std::exception_ptr>> completed;
+        {
+            std::lock_guard<std::mutex> lock(m_completed_mutex);
+            m_completed->pop_all([&completed](size_t handle, std::exception_ptr exception_ptr) {
+                completed.emplace_back(handle, std::move(exception_ptr));
+            });
+        }
+        for (const auto& [handle, exception_ptr] : completed) {
+            if (exception_ptr) {
+                // The error of inference is raised by the next flow control call as for start_async
+                try {
+                    std::rethrow_exception(exception_ptr);
+                } catch (const std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+                } catch (...) {
+                    PyErr_SetString(PyExc_RuntimeError, "Unknown exception");
+                }
+                py::error_already_set py_error;
+                // acquire the mutex to access m_errors
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_errors.push(py_error);
+            } else if (m_callback) {
+                try {
+                    (*m_callback)(m_requests[handle], m_user_ids[handle]);
+                } catch (const py::error_already_set& py_error) {
+                    // acquire the mutex to access m_errors
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                }
+            }
+            m_batch_inputs[handle] = py::none();
+            m_notifications[handle] = {};
+        }
+        if (!completed.empty()) {
+            {
+                // acquire the mutex to access m_idle_handles
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (const auto& completion : completed) {
+                    m_idle_handles.push(completion.first);
+                }
+            }
+            m_cv.notify_all();
+        }
+        return completed.size();
     }
 
     void set_default_callbacks() {
+        m_callback = nullptr;
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
 
-            m_requests[handle].m_request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
+            m_requests[handle].set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
+                if (report_completion(handle, exception_ptr)) {
+                    return;
+                }
                 {
                     // acquire the mutex to access m_idle_handles
                     std::lock_guard<std::mutex> lock(m_mutex);
@@ -113,10 +357,14 @@ public:
     void set_custom_callbacks(py::function f_callback) {
         // need to acquire GIL before py::function deletion
         auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
+        m_callback = callback_sp;
 
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            m_requests[handle].m_request.set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
+            m_requests[handle].set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
+                if (report_completion(handle, exception_ptr)) {
+                    return;
+                }
                 if (exception_ptr == nullptr) {
                     // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
                     py::gil_scoped_acquire acquire;
@@ -154,11 +402,44 @@ public:
         }
     }
 
+    bool report_completion(size_t handle, const std::exception_ptr& exception_ptr) {
+        // Requests started by `_start_async_notify` and `start_async_many` don't call the callback here,
+        // the handle is returned to the idle queue by the consumer after it takes the results
+        const auto& notification = m_notifications[handle];
+        if (notification.channel) {
+            notification.channel->notify(notification.token, exception_ptr);
+            return true;
+        }
+        if (notification.batched) {
+            m_completed->push(handle, exception_ptr);
+            {
+                // synchronize with the waiters checking the ring under the mutex to not lose the wakeup
+                std::lock_guard<std::mutex> lock(m_mutex);
+            }
+            m_cv.notify_all();
+            return true;
+        }
+        return false;
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
     std::queue<size_t> m_idle_handles;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
+    // Completion channels of the requests started by `_start_async_notify`,
+    // channel is nullptr for the requests started by `start_async`
+    struct Notification {
+        std::shared_ptr<CompletionChannel> channel;
+        size_t token = 0;
+        // the request is started by `start_async_many` and its completion is pushed to m_completed
+        bool batched = false;
+    };
+    std::vector<Notification> m_notifications;
+    std::unique_ptr<CompletionRing> m_completed;
+    std::mutex m_completed_mutex;  // serializes the consumers of m_completed
+    std::vector<py::object> m_batch_inputs;
+    std::shared_ptr<py::function> m_callback;
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
@@ -196,6 +477,7 @@ void regclass_AsyncInferQueue(py::module m) {
             }
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
+            self.m_notifications[handle] = {};
             // Update inputs if there are any
             self.m_requests[handle].m_request.set_input_tensor(inputs);
             // Now GIL can be released - we are NOT working with Python objects in this block
@@ -242,6 +524,7 @@ void regclass_AsyncInferQueue(py::module m) {
             }
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
+            self.m_notifications[handle] = {};
             // Update inputs if there are any
             Common::set_request_tensors(self.m_requests[handle].m_request, inputs);
             // Now GIL can be released - we are NOT working with Python objects in this block
@@ -269,6 +552,98 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    cls.def("start_async_many",
+            &AsyncInferQueue::start_async_many,
+            py::arg("inputs"),
+            py::arg("userdata") = py::none(),
+            R"(
+            Run asynchronous inference of a batch of inputs using the available InferRequests.
+
+            Inputs of several requests are bound at once and the requests are started
+            within a single GIL release. Tensors are bound as is, so the data they share
+            must not be modified until the completion of the request.
+
+            Completions are collected without taking the GIL and are processed in bulk
+            (the callback set by `set_callback` is called) on the Python thread calling
+            `start_async_many`, `get_idle_request_id`, `start_async` or `wait_all`.
+            A request is returned to the pool after its completion is processed.
+            The callback is not called for a failed request, its error is raised
+            by the following flow control call, e.g. `wait_all`.
+
+            GIL is released while waiting for the available InferRequests.
+
+            :param inputs: Data to set on input tensors of InferRequests, one dict per request.
+            :type inputs: list[dict[Union[int, str, openvino.ConstOutput] : openvino.Tensor]]
+            :param userdata: Data passed to a callback, one item per request.
+            :type userdata: Optional[list[Any]]
+            :rtype: None
+        )");
+
+    cls.def("process_completed",
+            &AsyncInferQueue::process_completed,
+            R"(
+            Processes completions of the requests started by `start_async_many`:
+            calls the callback for each of them and returns the requests to the pool.
+
+            :return: Number of processed completions.
+            :rtype: int
+        )");
+
+    cls.def(
+        "_start_async_notify",
+        [](AsyncInferQueue& self,
+           size_t handle,
+           const py::dict& inputs,
+           const std::shared_ptr<CompletionChannel>& channel,
+           size_t token) {
+            self.m_user_ids[handle] = py::none();
+            self.m_notifications[handle] = {channel, token};
+            Common::set_request_tensors(self.m_requests[handle].m_request, inputs);
+            py::gil_scoped_release release;
+            *self.m_requests[handle].m_start_time = Time::now();
+            self.m_requests[handle].m_request.start_async();
+        },
+        py::arg("handle"),
+        py::arg("inputs"),
+        py::arg("channel"),
+        py::arg("token"),
+        R"(
+            Runs asynchronous inference on the InferRequest taken by `_try_get_idle_request_id`.
+            The completion is reported to the channel with the given token,
+            the callback set by `set_callback` is not called. The request stays busy
+            until it is returned by `_release_request_id`.
+
+            GIL is released while running the inference.
+
+            :param handle: InferRequest id.
+            :type handle: int
+            :param inputs: Data to set on input tensors of the InferRequest.
+            :type inputs: dict[Union[int, str, openvino.ConstOutput] : openvino.Tensor]
+            :param channel: Channel to report the completion to.
+            :type channel: openvino._CompletionChannel
+            :param token: Identifier of the request in the channel.
+            :type token: int
+        )");
+
+    cls.def("_try_get_idle_request_id",
+            &AsyncInferQueue::try_get_idle_request_id,
+            R"(
+            Takes next free InferRequest from queue's pool without waiting.
+
+            :return: InferRequest id or None if all the requests are busy.
+            :rtype: Optional[int]
+        )");
+
+    cls.def("_release_request_id",
+            &AsyncInferQueue::release_request_id,
+            py::arg("handle"),
+            R"(
+            Returns InferRequest started by `_start_async_notify` to queue's pool.
+
+            :param handle: InferRequest id.
+            :type handle: int
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pyopenvino/core/completion_channel.hpp"
+
+#include <pybind11/stl.h>
+
+#include <cerrno>
+#include <cstdint>
+
+#include "openvino/core/except.hpp"
+
+#if defined(__linux__)
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#elif !defined(_WIN32)
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+namespace py = pybind11;
+
+CompletionChannel::CompletionChannel() {
+#if defined(__linux__)
+    m_read_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    OPENVINO_ASSERT(m_read_fd >= 0, "Failed to create eventfd for completion channel, errno: ", errno);
+    m_write_fd = m_read_fd;
+#elif !defined(_WIN32)
+    int fds[2];
+    OPENVINO_ASSERT(pipe(fds) == 0, "Failed to create pipe for completion channel, errno: ", errno);
+    for (auto fd : fds) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    m_read_fd = fds[0];
+    m_write_fd = fds[1];
+#endif
+    // On Windows there is no descriptor to be polled by the event loop, the consumer uses blocking drain
+}
+
+CompletionChannel::~CompletionChannel() {
+#if !defined(_WIN32)
+    if (m_write_fd != m_read_fd) {
+        ::close(m_write_fd);
+    }
+    ::close(m_read_fd);
+#endif
+}
+
+void CompletionChannel::signal() {
+#if defined(__linux__)
+    const uint64_t one = 1;
+    // The only possible failure is a counter overflow which still leaves the descriptor readable
+    [[maybe_unused]] auto written = write(m_write_fd, &one, sizeof(one));
+#elif !defined(_WIN32)
+    const char byte = 0;
+    // A full pipe is already readable, so EAGAIN is not an error
+    [[maybe_unused]] auto written = write(m_write_fd, &byte, 1);
+#endif
+}
+
+void CompletionChannel::reset_signal() {
+#if defined(__linux__)
+    uint64_t value = 0;
+    [[maybe_unused]] auto read_bytes = read(m_read_fd, &value, sizeof(value));
+#elif !defined(_WIN32)
+    char buffer[64];
+    while (read(m_read_fd, buffer, sizeof(buffer)) > 0) {
+    }
+#endif
+}
+
+void CompletionChannel::notify(size_t token, const std::exception_ptr& exception_ptr) {
+    std::optional<std::string> error;
+    if (exception_ptr) {
+        try {
+            std::rethrow_exception(exception_ptr);
+        } catch (const std::exception& e) {
+            error = e.what();
+        } catch (...) {
+            error = "Unknown exception";
+        }
+    }
+
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed) {
+            return;
+        }
+        first = m_completions.empty();
+        m_completions.emplace_back(token, std::move(error));
+        // The batch is signaled once, the consumer takes all the completions accumulated until it wakes up
+        if (first) {
+            signal();
+        }
+    }
+    if (first) {
+        m_cv.notify_one();
+    }
+}
+
+std::vector<CompletionChannel::Completion> CompletionChannel::drain(bool block) {
+    std::vector<Completion> completions;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (block) {
+        m_cv.wait(lock, [this] {
+            return !m_completions.empty() || m_closed;
+        });
+    }
+    if (!m_completions.empty()) {
+        completions.swap(m_completions);
+        reset_signal();
+    }
+    return completions;
+}
+
+void CompletionChannel::close() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_completions.clear();
+    }
+    m_cv.notify_all();
+}
+
+void regclass_CompletionChannel(py::module m) {
+    py::class_<CompletionChannel, std::shared_ptr<CompletionChannel>> cls(m, "_CompletionChannel");
+    cls.doc() = "openvino._CompletionChannel delivers completions of asynchronous inference requests "
+                "to an event loop in batches through a single wakeup descriptor.";
+
+    cls.def(py::init<>());
+
+    cls.def("fileno",
+            &CompletionChannel::fileno,
+            R"(
+            Returns the descriptor which becomes readable when there are completions to drain.
+
+            :return: File descriptor or -1 if the platform does not support it.
+            :rtype: int
+        )");
+
+    cls.def(
+        "drain",
+        [](CompletionChannel& self, bool block) {
+            std::vector<CompletionChannel::Completion> completions;
+            {
+                py::gil_scoped_release release;
+                completions = self.drain(block);
+            }
+            return completions;
+        },
+        py::arg("block") = false,
+        R"(
+            Takes all the completions accumulated since the previous call.
+
+            GIL is released while running this function.
+
+            :param block: Wait for at least one completion or for the channel to be closed.
+            :type block: bool
+            :return: Pairs of request tokens and error messages (None on success).
+            :rtype: list[tuple[int, Optional[str]]]
+        )");
+
+    cls.def("close",
+            &CompletionChannel::close,
+            R"(
+            Closes the channel: wakes up the blocked `drain` and drops the completions reported after that.
+        )");
+}
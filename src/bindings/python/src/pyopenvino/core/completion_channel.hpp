@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+// CompletionChannel collects completions of asynchronous requests from the inference threads
+// without touching the GIL. The consumer (asyncio event loop) is woken up through a single file
+// descriptor (eventfd or pipe) once per batch: the descriptor is signaled only when the first
+// completion is added to the empty batch, so thousands of completions cost a single wakeup.
+class CompletionChannel {
+public:
+    using Completion = std::pair<size_t, std::optional<std::string>>;
+
+    CompletionChannel();
+    ~CompletionChannel();
+
+    CompletionChannel(const CompletionChannel&) = delete;
+    CompletionChannel& operator=(const CompletionChannel&) = delete;
+
+    // Descriptor which becomes readable when there are completions to drain, -1 if not supported by the platform
+    int fileno() const {
+        return m_read_fd;
+    }
+
+    // Is called from the callbacks of requests, `token` identifies the request for the consumer
+    void notify(size_t token, const std::exception_ptr& exception_ptr);
+
+    // Takes all the pending completions, blocks until there is at least one if `block` is set.
+    // Returns an empty batch from the blocking call once the channel is closed.
+    std::vector<Completion> drain(bool block);
+
+    // Wakes up the blocked consumer and drops the completions reported after that.
+    // The descriptors stay open until the channel is destroyed since the callbacks of
+    // the requests in flight may still hold it.
+    void close();
+
+private:
+    void signal();
+    void reset_signal();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<Completion> m_completions;
+    bool m_closed = false;
+    int m_read_fd = -1;
+    int m_write_fd = -1;
+};
+
+void regclass_CompletionChannel(py::module m);
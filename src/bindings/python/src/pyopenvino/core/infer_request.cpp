@@ -11,6 +11,7 @@
 #include <string>
 
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/core/completion_channel.hpp"
 #include "pyopenvino/core/remote_tensor.hpp"
 #include "pyopenvino/utils/utils.hpp"
 
@@ -384,6 +385,59 @@ void regclass_InferRequest(py::module m) {
             :type userdata: Any
         )");
 
+    cls.def(
+        "_start_async_notify",
+        [](InferRequestWrapper& self,
+           const py::dict& inputs,
+           const std::shared_ptr<CompletionChannel>& channel,
+           size_t token) {
+            Common::set_request_tensors(self.m_request, inputs);
+            // The completion is reported through the channel, so the callback doesn't need the GIL.
+            // The request is already idle when the callback is called, so the previous callback
+            // is restored there before the completion becomes visible to the consumer.
+            auto end_time = self.m_end_time;
+            self.m_request.set_callback([&self, end_time, channel, token](std::exception_ptr exception_ptr) {
+                *end_time = Time::now();
+                self.m_request.set_callback(self.m_callback);
+                channel->notify(token, exception_ptr);
+            });
+            py::gil_scoped_release release;
+            *self.m_start_time = Time::now();
+            self.m_request.start_async();
+        },
+        py::arg("inputs"),
+        py::arg("channel"),
+        py::arg("token"),
+        R"(
+            Starts inference of specified input(s) in asynchronous mode and reports
+            its completion to the channel with the given token.
+            The callback set by `set_callback` is not called for this inference
+            and is restored when the inference completes.
+
+            GIL is released while running the inference.
+
+            :param inputs: Data to set on input tensors.
+            :type inputs: dict[Union[int, str, openvino.ConstOutput], openvino.Tensor]
+            :param channel: Channel to report the completion to.
+            :type channel: openvino._CompletionChannel
+            :param token: Identifier of the request in the channel.
+            :type token: int
+        )");
+
+    cls.def(
+        "_get_results",
+        [](InferRequestWrapper& self, bool share_outputs, bool decode_strings) {
+            return Common::outputs_to_dict(self, share_outputs, decode_strings);
+        },
+        py::arg("share_outputs"),
+        py::arg("decode_strings"),
+        R"(
+            Gets all outputs tensors of this InferRequest.
+
+            :return: Dictionary of results from output tensors with ports as keys.
+            :rtype: dict[openvino.ConstOutput, numpy.array]
+        )");
+
     cls.def(
         "cancel",
         [](InferRequestWrapper& self) {
@@ -435,7 +489,7 @@ void regclass_InferRequest(py::module m) {
             // need to acquire GIL before py::function deletion
             auto callback_sp = Common::utils::wrap_pyfunction(std::move(callback));
 
-            self.m_request.set_callback([&self, callback_sp](std::exception_ptr exception_ptr) {
+            self.set_callback([&self, callback_sp](std::exception_ptr exception_ptr) {
                 *self.m_end_time = Time::now();
                 try {
                     if (exception_ptr) {
@@ -7,6 +7,8 @@
 #include <pybind11/pybind11.h>
 
 #include <chrono>
+#include <exception>
+#include <functional>
 #include <openvino/runtime/infer_request.hpp>
 
 #include "openvino/core/except.hpp"
@@ -45,7 +47,7 @@ public:
             // Bump reference counter
             auto end_time = m_end_time;
             // Set standard callback which saves "end-time" for inference call
-            m_request.set_callback([end_time](std::exception_ptr exception_ptr) {
+            set_callback([end_time](std::exception_ptr exception_ptr) {
                 *end_time = Time::now();
                 try {
                     if (exception_ptr) {
@@ -60,6 +62,13 @@ public:
 
     // ~InferRequestWrapper() = default;
 
+    // Sets the callback of the request and remembers it, so it can be restored
+    // after a run which reports its completion in a different way
+    void set_callback(std::function<void(std::exception_ptr)> callback) {
+        m_callback = callback;
+        m_request.set_callback(std::move(callback));
+    }
+
     ov::TensorVector get_input_tensors() {
         return get_tensors_from(m_inputs);
     }
@@ -80,6 +89,8 @@ public:
     std::vector<ov::Output<const ov::Node>> m_outputs;
     // A flag which is set when a user defines a custom callback on InferRequest
     bool m_user_callback_defined = false;
+    // The callback set by `set_callback`
+    std::function<void(std::exception_ptr)> m_callback;
     // Data that is passed by user from Python->C++
     std::shared_ptr<py::object> m_userdata;
     // Times of inference's start and finish
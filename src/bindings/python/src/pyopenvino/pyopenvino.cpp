@@ -27,6 +27,7 @@
 #endif
 #include "pyopenvino/core/async_infer_queue.hpp"
 #include "pyopenvino/core/compiled_model.hpp"
+#include "pyopenvino/core/completion_channel.hpp"
 #include "pyopenvino/core/core.hpp"
 #include "pyopenvino/core/extension.hpp"
 #include "pyopenvino/core/infer_request.hpp"
@@ -293,6 +294,7 @@ PYBIND11_MODULE(_pyopenvino, m) {
     regclass_ProfilingInfo(m);
     regclass_VariableState(m);
     regclass_RemoteTensor(m);
+    regclass_CompletionChannel(m);
     regclass_InferRequest(m);
     regclass_RemoteContext(m);
     regclass_Core(m);
@@ -2,11 +2,15 @@
 # Copyright (C) 2018-2026 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+import asyncio
 from collections.abc import Iterable
 from copy import deepcopy
+import gc
 import numpy as np
 import pytest
+import threading
 import time
+import weakref
 
 import openvino.opset13 as ops
 from openvino import (
@@ -18,6 +22,8 @@ from openvino import (
     Type,
     Tensor,
 )
+from openvino._ov_api import _CompletionDispatcher
+from openvino._pyopenvino import _CompletionChannel
 from tests import skip_need_mock_op
 from tests.utils.helpers import (
     generate_image,
@@ -381,3 +387,172 @@ def test_array_like_input_async(device, share_inputs):
     request.start_async(model_input_list)
     request.wait()
     assert np.array_equal(request.get_output_tensor().data, np.abs(input_data))
+
+
+def test_infer_queue_start_async_many(device):
+    jobs = 32
+    num_request = 4
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    images = [generate_image() - i / jobs for i in range(jobs)]
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_callback(callback)
+    # More inputs than requests in the pool, so completions are processed while submitting
+    infer_queue.start_async_many([{"data": img} for img in images], list(range(jobs)))
+    infer_queue.wait_all()
+    for img, result in zip(images, results):
+        assert np.array_equal(result, np.maximum(img, 0))
+    assert infer_queue.is_ready()
+    assert infer_queue.process_completed() == 0
+
+    # Regular start_async can follow start_async_many
+    infer_queue.start_async({"data": images[0]}, 0)
+    infer_queue.wait_all()
+    assert np.array_equal(results[0], np.maximum(images[0], 0))
+
+
+@skip_need_mock_op
+def test_infer_queue_start_async_many_fail_in_inference(device):
+    core = Core()
+    data = ops.parameter([10], dtype=np.float32, name="data")
+    k_op = ops.parameter(Shape([]), dtype=np.int32, name="k")
+    emb = ops.topk(data, k_op, axis=0, mode="max", sort="value")
+    model = Model(emb, [data, k_op])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    completed = []
+
+    def callback(request, job_id):
+        completed.append(job_id)
+
+    infer_queue.set_callback(callback)
+    data_tensor = Tensor(np.arange(10).astype(np.float32))
+    # The third request of the batch asks for more elements than there are
+    inputs = [{"data": data_tensor, "k": Tensor(np.array(k, dtype=np.int32))} for k in (3, 5, 11, 7)]
+    infer_queue.start_async_many(inputs, list(range(len(inputs))))
+
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.wait_all()
+    assert "Can not clone with new dims" in str(e.value)
+    assert sorted(completed) == [0, 1, 3]
+    # All the completions, including the failed one, are processed
+    assert infer_queue.process_completed() == 0
+
+
+def test_infer_queue_start_async_many_userdata_mismatch(device):
+    core = Core()
+    compiled_model = core.compile_model(get_relu_model(), device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+    with pytest.raises(ValueError, match="userdata"):
+        infer_queue.start_async_many([generate_image()] * 2, [0])
+
+
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_infer_async_awaitable(device, share_inputs):
+    _, request, _, input_data = generate_abs_compiled_model_with_data(device, Type.f32, np.single)
+
+    async def run():
+        outputs = []
+        for i in range(3):
+            outputs.append(await request.infer_async({0: input_data * i}, share_inputs=share_inputs))
+        return outputs
+
+    for i, result in enumerate(asyncio.run(run())):
+        assert np.array_equal(result[0], np.abs(input_data * i))
+    assert request.latency > 0
+
+
+def test_infer_async_restores_callback(device):
+    _, request, _, input_data = generate_abs_compiled_model_with_data(device, Type.f32, np.single)
+    calls = []
+    request.set_callback(lambda userdata: calls.append(userdata), "user")
+
+    async def run():
+        return await request.infer_async({0: input_data})
+
+    result = asyncio.run(run())
+    assert np.array_equal(result[0], np.abs(input_data))
+    assert calls == []
+
+    # The callback set by the user is back for the regular asynchronous inference
+    request.start_async({0: input_data})
+    request.wait()
+    assert calls == ["user"]
+
+
+def test_infer_async_dispatcher_is_released_with_loop(device):
+    _, request, _, input_data = generate_abs_compiled_model_with_data(device, Type.f32, np.single)
+    loops = []
+
+    async def run():
+        loops.append(weakref.ref(asyncio.get_running_loop()))
+        await request.infer_async({0: input_data})
+
+    for _ in range(3):
+        asyncio.run(run())
+    gc.collect()
+    assert all(loop() is None for loop in loops)
+    assert len(_CompletionDispatcher._dispatchers) == 0
+
+
+def test_completion_channel_close_wakes_up_drain():
+    channel = _CompletionChannel()
+    batches = []
+    waiter = threading.Thread(target=lambda: batches.append(channel.drain(block=True)))
+    waiter.start()
+    channel.close()
+    waiter.join(timeout=10)
+    assert not waiter.is_alive()
+    assert batches == [[]]
+
+
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_infer_queue_infer_async(device, share_inputs):
+    jobs = 64
+    num_request = 4
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    images = [generate_image() - i / jobs for i in range(jobs)]
+
+    async def run():
+        # More jobs than requests in the pool are in flight at once
+        return await asyncio.gather(*[infer_queue.infer_async({"data": img}, share_inputs=share_inputs)
+                                      for img in images])
+
+    results = asyncio.run(run())
+    assert len(results) == jobs
+    for img, result in zip(images, results):
+        assert np.array_equal(result[0], np.maximum(img, 0))
+    assert infer_queue.is_ready()
+
+
+@skip_need_mock_op
+def test_infer_queue_infer_async_fail_in_inference(device):
+    core = Core()
+    data = ops.parameter([10], dtype=np.float32, name="data")
+    k_op = ops.parameter(Shape([]), dtype=np.int32, name="k")
+    emb = ops.topk(data, k_op, axis=0, mode="max", sort="value")
+    model = Model(emb, [data, k_op])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    data_tensor = Tensor(np.arange(10).astype(np.float32))
+    k_tensor = Tensor(np.array(11, dtype=np.int32))
+
+    async def run():
+        return await infer_queue.infer_async({"data": data_tensor, "k": k_tensor})
+
+    with pytest.raises(RuntimeError) as e:
+        asyncio.run(run())
+    assert "Can not clone with new dims" in str(e.value)
+    # The failed request is returned to the pool
+    for _ in range(2):
+        assert infer_queue._try_get_idle_request_id() is not None
@@ -275,6 +275,8 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (props.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (props.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (props.enable_converted_model_cache, "ENABLE_CONVERTED_MODEL_CACHE", ((True, True), (False, False))),
+        (props.variables_prefetch_budget, "VARIABLES_PREFETCH_BUDGET", ((0, 0), (1024, 1024))),
         (
             props.weights_path,
             "WEIGHTS_PATH",
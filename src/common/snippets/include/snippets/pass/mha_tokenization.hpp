@@ -40,6 +40,10 @@ namespace ov::snippets::pass {
  *          - [...] means any count of different nodes from list. But:
  *              * Reshapes can be only explicitly around Softmax (Reshape -> Softmax -> Reshape)
  *              * After MatMul1 may be only Transpose3 or any count of Eltwise, Select ops.
+ *          - If RoPE tokenization is enabled, elementwise part of rotary positional embeddings
+ *            `Add(Multiply(x, cos), Multiply(rotate_half(x), sin))` on inputs of MatMul0 is fused into Subgraph as
+ *            well, so rotated Queries (and Keys if they are not transposed) are computed in the MHA kernel and
+ *            stored only to its Buffer. rotate_half(x) is Concat of the halves of x taken by Split or Slice.
  * @ingroup snippets
  */
 class TokenizeMHASnippets : public ov::pass::MatcherPass {
@@ -55,11 +59,13 @@ public:
         Config(const TokenizationConfig& tokenization_config,
                bool enable_transpose_on_output,
                bool dyn_mha_token,
-               std::set<size_t> mha_transpose_ranks)
+               std::set<size_t> mha_transpose_ranks,
+               bool rope_mha_token = false)
             : TokenizationConfig(tokenization_config),
               m_mha_token_enable_transpose_on_output(enable_transpose_on_output),
               m_is_dynamic_mha_token_enabled(dyn_mha_token),
-              m_mha_supported_transpose_ranks(std::move(mha_transpose_ranks)) {}
+              m_mha_supported_transpose_ranks(std::move(mha_transpose_ranks)),
+              m_is_rope_mha_token_enabled(rope_mha_token) {}
 
         [[nodiscard]] bool get_mha_token_enable_transpose_on_output() const {
             return m_mha_token_enable_transpose_on_output;
@@ -73,6 +79,10 @@ public:
             return m_mha_supported_transpose_ranks;
         }
 
+        [[nodiscard]] bool is_rope_mha_token_enabled() const {
+            return m_is_rope_mha_token_enabled;
+        }
+
     private:
         // False if Transpose on output isn't tokenized in MHA Tokenization.
         // Otherwise, it may be fused into Subgraph if possible
@@ -85,6 +95,8 @@ public:
         // Note that in general Snippets support Transpose of any ranks.
         // But at the moment Transpose is used only in MHA pattern where 3D and 4D tensors are supported.
         std::set<size_t> m_mha_supported_transpose_ranks = {3, 4};
+        // If True, elementwise part of RoPE on MatMul0 inputs is tokenized into MHA Subgraph
+        bool m_is_rope_mha_token_enabled = false;
     };
 
     explicit TokenizeMHASnippets(const Config& config);
@@ -19,11 +19,13 @@
 #include "openvino/core/dimension.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_vector.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/fake_quantize.hpp"
 #include "openvino/op/select.hpp"
+#include "openvino/op/slice.hpp"
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/op/util/binary_elementwise_arithmetic.hpp"
 #include "openvino/op/util/unary_elementwise_arithmetic.hpp"
@@ -206,6 +208,106 @@ bool update_intermediate_supported_ops(std::shared_ptr<ov::Node>& interm_op,
     return true;
 }
 
+// Returns true if `rotated` is rotate_half(x): the halves of x along the last axis swapped by Concat.
+// The moved second half may be negated, otherwise the sign is expected to be in the sin table.
+bool is_rotate_half(const ov::Output<ov::Node>& rotated, const ov::Output<ov::Node>& x) {
+    const auto concat = ov::as_type_ptr<ov::opset1::Concat>(rotated.get_node_shared_ptr());
+    const auto rank = x.get_partial_shape().rank();
+    if (!concat || concat->get_input_size() != 2 || rank.is_dynamic() ||
+        concat->get_output_partial_shape(0) != x.get_partial_shape()) {
+        return false;
+    }
+    const auto axis = concat->get_axis() < 0 ? concat->get_axis() + rank.get_length() : concat->get_axis();
+    if (axis != rank.get_length() - 1) {
+        return false;
+    }
+
+    auto skip_negation = [](const ov::Output<ov::Node>& half) {
+        const auto& node = half.get_node_shared_ptr();
+        if (ov::is_type<ov::opset1::Negative>(node)) {
+            return node->input_value(0);
+        }
+        if (ov::is_type<ov::opset1::Multiply>(node)) {
+            const auto scale = ov::as_type_ptr<ov::opset1::Constant>(node->get_input_node_shared_ptr(1));
+            if (scale && ov::shape_size(scale->get_shape()) == 1 && scale->cast_vector<float>()[0] == -1.F) {
+                return node->input_value(0);
+            }
+        }
+        return half;
+    };
+    const auto second_half = skip_negation(concat->input_value(0));
+    const auto first_half = skip_negation(concat->input_value(1));
+    const auto& split = second_half.get_node_shared_ptr();
+    if (ov::is_type<ov::opset1::Split>(split) || ov::is_type<ov::opset1::VariadicSplit>(split)) {
+        return split == first_half.get_node_shared_ptr() && split->get_output_size() == 2 &&
+               split->input_value(0) == x && first_half.get_index() == 0 && second_half.get_index() == 1;
+    }
+    auto is_slice_of_x = [&x](const ov::Output<ov::Node>& half) {
+        const auto& node = half.get_node_shared_ptr();
+        return (ov::is_type<ov::op::v8::Slice>(node) || ov::is_type<ov::opset1::StridedSlice>(node)) &&
+               node->input_value(0) == x;
+    };
+    return is_slice_of_x(first_half) && is_slice_of_x(second_half) &&
+           first_half.get_node() != second_half.get_node();
+}
+
+// Returns true if `table` can be the cos or sin table of RoPE applied to x: it has the same head size
+// and doesn't broadcast x to the bigger rank
+bool is_rope_table(const ov::Output<ov::Node>& table, const ov::Output<ov::Node>& x) {
+    const auto& table_shape = table.get_partial_shape();
+    const auto& x_shape = x.get_partial_shape();
+    return table_shape.rank().is_static() && x_shape.rank().is_static() && table_shape.size() <= x_shape.size() &&
+           table_shape.size() > 0 && table_shape[table_shape.size() - 1].compatible(x_shape[x_shape.size() - 1]);
+}
+
+// Returns ops of elementwise part of rotary positional embeddings (RoPE) on MatMul input in topological order:
+//       x     cos  rotate_half(x)  sin
+//        \   /              \     /
+//      Multiply            Multiply
+//              \          /
+//                  Add
+//                   |
+//                 MatMul
+// The rotation itself (Split or Slice and Concat) stays outside of the Subgraph.
+ov::NodeVector get_rope_ops(const std::shared_ptr<ov::Node>& node) {
+    auto is_supported_rope_op = [](const std::shared_ptr<ov::Node>& op) {
+        return is_supported_intermediate_op(op) && op->get_output_target_inputs(0).size() == 1 &&
+               is_supported_tensor(op->get_output_tensor(0)) &&
+               ov::snippets::pass::GetSnippetsNodeType(op) != ov::snippets::pass::SnippetsNodeType::SkippedByPlugin;
+    };
+
+    const auto add = ov::as_type_ptr<ov::opset1::Add>(node);
+    if (!add || !is_supported_rope_op(add)) {
+        return {};
+    }
+    ov::NodeVector rope_ops;
+    for (const auto& input : add->input_values()) {
+        const auto multiply = ov::as_type_ptr<ov::opset1::Multiply>(input.get_node_shared_ptr());
+        // Multiplies mustn't broadcast the result of RoPE: the shape is defined by the rotated tensor
+        if (!multiply || !is_supported_rope_op(multiply) ||
+            multiply->get_output_partial_shape(0) != add->get_output_partial_shape(0)) {
+            return {};
+        }
+        rope_ops.push_back(multiply);
+    }
+
+    // One Multiply takes x and cos, another one takes rotate_half(x) and sin
+    for (const auto& [mul_cos, mul_sin] : {std::make_pair(rope_ops[0], rope_ops[1]),
+                                           std::make_pair(rope_ops[1], rope_ops[0])}) {
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 2; ++j) {
+                const auto x = mul_cos->input_value(i);
+                if (is_rotate_half(mul_sin->input_value(j), x) && is_rope_table(mul_cos->input_value(1 - i), x) &&
+                    is_rope_table(mul_sin->input_value(1 - j), x)) {
+                    rope_ops.push_back(add);
+                    return rope_ops;
+                }
+            }
+        }
+    }
+    return {};
+}
+
 std::vector<int32_t> get_rank_equivalent_order(std::vector<int32_t> default_order, size_t rank) {
     assert(rank > 2 && "Incorrect order rank for Transpose tokenization");
     auto order = std::vector<int32_t>(rank);
@@ -357,6 +459,35 @@ ov::snippets::pass::TokenizeMHASnippets::TokenizeMHASnippets(const Config& confi
                 n_buffer_reg_groups++;
             }
 
+            /***** RoPE *****/
+            /* Elementwise part of RoPE on Queries and Keys is tokenized, so it is computed in the MHA kernel
+             * instead of a separate node, which writes the full rotated tensor to memory and reads it back
+             *    [RoPE]  [RoPE]
+             *        \    /
+             *        MatMul0
+             * Notes:
+             *   - Keys are supported only if they are not transposed: ExplicitTransposeMatMulInputs cannot move
+             *     Transpose through non-scalar Eltwise ops
+             *   - 4 inputs of RoPE (x, cos, rotate_half(x), sin) replace one input of MatMul0
+             *   - the rotated tensor is stored to the Buffer before MatMul0
+             */
+            if (config.is_rope_mha_token_enabled()) {
+                size_t rope_ops_count = 0;
+                for (size_t i = 0; i < matmul0->get_input_size(); ++i) {
+                    if (i == 1 && matmul0->get_transpose_b()) {
+                        continue;
+                    }
+                    const auto rope_ops = get_rope_ops(matmul0->get_input_node_shared_ptr(i));
+                    if (rope_ops.empty()) {
+                        continue;
+                    }
+                    ordered_ops.insert(ordered_ops.begin() + rope_ops_count, rope_ops.begin(), rope_ops.end());
+                    rope_ops_count += rope_ops.size();
+                    n_potential_body_params += 3;
+                    n_buffer_reg_groups++;
+                }
+            }
+
             /***** Transposes *****/
             /* There may be Transpose and Reshape ops on inputs and outputs of MHA-pattern skeleton
              * We can add them into Subgraph body
@@ -305,6 +305,21 @@ TEST_F(TokenizeMHASnippetsTests, smoke_Snippets_MHA_Rank_Change_Reshape_extracti
     execute_and_validate_function(*this, f);
 }
 
+TEST_F(TokenizeMHASnippetsTests, smoke_Snippets_MHA_RoPE) {
+    const auto& f = MHARoPEFunction(std::vector<PartialShape>{{1, 12, 128, 64},
+                                                              {1, 1, 128, 64},
+                                                              {1, 1, 128, 64},
+                                                              {1, 12, 64, 128},
+                                                              {1, 12, 128, 64}});
+    mha_config = ov::snippets::pass::TokenizeMHASnippets::Config(
+        ov::snippets::pass::TokenizationConfig(std::numeric_limits<size_t>::max()),
+        true,
+        true,
+        {3, 4},
+        true);
+    execute_and_validate_function(*this, f);
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
@@ -7,6 +7,8 @@
 #include <iostream>
 #include <map>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "openvino/core/attribute_visitor.hpp"
@@ -21,9 +23,22 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true);
+    /**
+     * @param bin_data output stream for the constants data
+     * @param enable_compression deduplicate constants with the same data
+     * @param data_alignment if not zero, the data of constants which are not smaller than the alignment is placed
+     *        at offsets multiple of it (e.g. page size to use the weights in place when the file is mmapped)
+     */
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, size_t data_alignment = 0);
     virtual ~ConstantWriter();
 
+    /**
+     * @brief Computes hashes of the data blobs which are going to be written in parallel,
+     *        so the following writes of the blobs only look up the duplicates and write the data.
+     * @param blobs pointers and sizes of the data (as it's written, without fp16 compression)
+     */
+    void precompute_hashes(const std::vector<std::pair<const char*, size_t>>& blobs);
+
     virtual FilePosition write(const char* ptr,
                                size_t size,
                                size_t& new_size,
@@ -43,11 +58,16 @@ private:
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
+    HashValue get_hash(const char* ptr, size_t size);
+    void align_output(size_t size);
+
     ConstWritePositions m_hash_to_file_positions;
+    std::unordered_map<const void*, std::pair<size_t, HashValue>> m_precomputed_hashes;
     std::vector<std::vector<char>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
+    size_t m_data_alignment;
 };
 }  // namespace ov::util
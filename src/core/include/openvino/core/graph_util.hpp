@@ -7,6 +7,7 @@
 #include <deque>
 #include <filesystem>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
 #include <stack>
@@ -238,20 +239,29 @@ void replace_nodes(const std::shared_ptr<Model>& f,
 /// \warning The caller is responsible for clean-up the model connections when circular dependencies are present.
 template <typename T>
 std::vector<std::shared_ptr<Node>> topological_sort(T root_nodes) {
+    // Visit counter of the node, or node_done if the node is already added to the result.
+    // A single map saves a lookup per visit and a hash node per graph node compared to a done set and a visit map.
+    constexpr uint8_t node_done = std::numeric_limits<uint8_t>::max();
     std::stack<Node*, std::vector<Node*>> nodes_to_do;
-    std::unordered_set<Node*> nodes_done;
-    std::unordered_map<Node*, uint8_t /*is_visited*/> nodes_visited;
+    std::unordered_map<Node*, uint8_t> nodes_state;
     std::vector<std::shared_ptr<Node>> result;
 
+    auto is_done = [&nodes_state](Node* node) {
+        const auto it = nodes_state.find(node);
+        return it != nodes_state.end() && it->second == node_done;
+    };
+
     for (auto& node : root_nodes) {
         nodes_to_do.push(node.get());
     }
     while (nodes_to_do.size() > 0) {
         Node* node = nodes_to_do.top();
-        if (nodes_done.count(node) == 0) {
+        // references to unordered_map elements stay valid on rehashing
+        auto& state = nodes_state[node];
+        if (state != node_done) {
             bool can_add = true;
-            if (++nodes_visited[node] > 2) {
-                // Node may be at the top of `nodes_to_do` not more than twice before it's added to `nodes_done` -
+            if (++state > 2) {
+                // Node may be at the top of `nodes_to_do` not more than twice before it's added to the result -
                 // when visited and placed in `nodes_to_do` and after the subtree traversal is finished.
                 // Otherwise it's a loop.
                 OPENVINO_THROW("Loop detected during topological sort starting from '",
@@ -262,14 +272,14 @@ std::vector<std::shared_ptr<Node>> topological_sort(T root_nodes) {
             size_t arg_count = node->get_input_size();
             for (size_t i = 0; i < arg_count; ++i) {
                 Node* dep = node->get_input_node_ptr(arg_count - i - 1);
-                if (nodes_done.count(dep) == 0) {
+                if (!is_done(dep)) {
                     can_add = false;
                     nodes_to_do.push(dep);
                 }
             }
             for (auto& depptr : node->get_control_dependencies()) {
                 Node* dep = depptr.get();
-                if (nodes_done.count(dep) == 0) {
+                if (!is_done(dep)) {
                     can_add = false;
                     nodes_to_do.push(dep);
                 }
@@ -277,7 +287,7 @@ std::vector<std::shared_ptr<Node>> topological_sort(T root_nodes) {
             if (can_add) {
                 result.push_back(node->shared_from_this());
                 nodes_to_do.pop();
-                nodes_done.insert(node);
+                state = node_done;
             }
         } else {
             nodes_to_do.pop();
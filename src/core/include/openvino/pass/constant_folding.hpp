@@ -23,9 +23,32 @@ public:
 
 protected:
     void copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node);
+    /// \brief Replaces outputs of original node with folded constants and propagates runtime info.
+    /// \return true if at least one output was replaced.
+    bool replace_with_folded_outputs(const std::shared_ptr<Node>& original_node, const OutputVector& replacements);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Splits foldable nodes into disjoint sub-graphs fed only by Constants and evaluates them
+    /// concurrently in bounded batches. Source constants which lose all consumers are evicted right after
+    /// their sub-graph is replaced. Nodes which can't be folded this way are left for the sequential loop.
+    bool concurrent_islands_folding(const std::shared_ptr<ov::Model>& model);
+};
+
+/**
+ * @brief Constant folding which evaluates disjoint constant sub-graphs (e.g. weights of different layers)
+ *        on a thread pool before the sequential folding loop of ConstantFolding.
+ *
+ * @note Node::can_constant_fold(), Node::constant_fold() and Node::evaluate() of different nodes are called
+ *       concurrently, so the pass may be used only for models whose operations do not share mutable state between
+ *       the nodes. The islands are folded before the pre-calculated values folding of ConstantFolding, so the nodes
+ *       are folded in another order than by the sequential pass.
+ * @ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API ConcurrentConstantFolding : public ConstantFolding {
+public:
+    OPENVINO_MODEL_PASS_RTTI("ConcurrentConstantFolding");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 };
 
 /**
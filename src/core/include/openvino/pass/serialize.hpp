@@ -46,6 +46,9 @@ public:
               const std::filesystem::path& bin_path,
               Version version = Version::UNSPECIFIED);
 
+protected:
+    bool serialize(const std::shared_ptr<ov::Model>& model, size_t constants_alignment);
+
 private:
     std::ostream* m_xml_file;
     std::ostream* m_bin_file;
@@ -55,6 +58,34 @@ private:
     const std::map<std::string, ov::OpSet> m_custom_opsets;
 };
 
+/**
+ * @brief AlignedSerialize transformation converts ov::Model into IR files placing the data of constants
+ * which are not smaller than the alignment at offsets multiple of it in the bin file (zero padded),
+ * e.g. page size alignment allows to use the weights in place when the IR is read with mmap.
+ * @attention
+ * - the alignment is available through this pass only, ov::save_model writes the constants without padding
+ * \ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API AlignedSerialize : public Serialize {
+public:
+    OPENVINO_MODEL_PASS_RTTI("AlignedSerialize");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    AlignedSerialize(std::ostream& xml_file,
+                     std::ostream& bin_file,
+                     size_t constants_alignment,
+                     Version version = Version::UNSPECIFIED);
+
+    AlignedSerialize(const std::filesystem::path& xml_path,
+                     const std::filesystem::path& bin_path,
+                     size_t constants_alignment,
+                     Version version = Version::UNSPECIFIED);
+
+private:
+    const size_t m_constants_alignment;
+};
+
 /**
  * @brief StreamSerialize transformation converts ov::Model into single binary stream
  * @attention
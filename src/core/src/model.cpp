@@ -287,6 +287,7 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     NodeVector nodes;
     auto node_inserter = std::back_inserter(nodes);
     if (m_shared_rt_info->get_use_topological_cache()) {
+        nodes.reserve(m_cached_ordered_ops.size());
         for (const auto& node : m_cached_ordered_ops) {
             if (auto locked_node = node.lock()) {
                 *node_inserter = locked_node;
@@ -310,6 +311,8 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
+    m_cached_ordered_ops.reserve(order.size());
+    m_cached_ops.reserve(order.size());
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
         m_cached_ops.insert(node.get());
@@ -4,8 +4,13 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/weight_sharing_util.hpp"
@@ -148,32 +153,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                             "constant_fold_default returned incorrect number of replacements for ",
                             node);
 
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = original_node->output(i);
-                const auto& replacement = replacements.at(i);
-                auto replacement_ptr = replacement.get_node_shared_ptr();
-                if (replacement_ptr && (node_output != replacement)) {
-                    replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(original_node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(original_node, replacement_ptr);
-                    ov::copy_weightless_cache_attr(original_node, replacement_ptr);
-                    // Evict data if original node is constant or convert with constant input
-                    if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(original_node)) {
-                        ov::wsh::Extension::hint_evict(*constant);
-                    } else if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(original_node)) {
-                        if (auto const_input = ov::as_type<ov::op::v0::Constant>(convert->get_input_node_ptr(0))) {
-                            ov::wsh::Extension::hint_evict(*const_input);
-                        }
-                    }
-
-                    rewritten = true;
-                }
-            }
+            rewritten = replace_with_folded_outputs(original_node, replacements) || rewritten;
         } else {
             // if CF was unsuccessful remove original precision attribute from inputs
             bool restored = restore_original_input_precision(original_node);
@@ -187,6 +167,215 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConcurrentConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(ConcurrentConstantFolding);
+
+    const bool rewritten = concurrent_islands_folding(model);
+    return ConstantFolding::run_on_model(model) || rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_with_folded_outputs(const std::shared_ptr<Node>& original_node,
+                                                           const OutputVector& replacements) {
+    bool replaced = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = original_node->output(i);
+        const auto& replacement = replacements.at(i);
+        auto replacement_ptr = replacement.get_node_shared_ptr();
+        if (replacement_ptr && (node_output != replacement)) {
+            replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(original_node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(original_node, replacement_ptr);
+            ov::copy_weightless_cache_attr(original_node, replacement_ptr);
+            // Evict data if original node is constant or convert with constant input
+            if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(original_node)) {
+                ov::wsh::Extension::hint_evict(*constant);
+            } else if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(original_node)) {
+                if (auto const_input = ov::as_type<ov::op::v0::Constant>(convert->get_input_node_ptr(0))) {
+                    ov::wsh::Extension::hint_evict(*const_input);
+                }
+            }
+
+            replaced = true;
+        }
+    }
+    return replaced;
+}
+
+namespace {
+/**
+ * \brief Check if node can be folded as a part of constant sub-graph evaluated in isolation from the model.
+ *
+ * Nodes which require precision conversion or restoring of original input precision, sub-graph operations and
+ * ShapeOf are excluded, they are handled by the sequential constant folding loop.
+ */
+bool is_island_candidate(const std::shared_ptr<ov::Node>& node) {
+    if (ov::op::util::is_constant(node) || node->get_output_size() == 0 ||
+        ov::pass::constant_folding_is_disabled(node) || !is_output_foldable(node->output(0)) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node) || ov::is_type<ov::op::util::ShapeOfBase>(node) ||
+        node_has_requires_precision_conversion_attribute(node)) {
+        return false;
+    }
+    const auto& inputs = node->inputs();
+    return std::none_of(inputs.begin(), inputs.end(), [](const ov::Input<ov::Node>& input) {
+        return ov::util::has_original_input_precision(input);
+    });
+}
+
+size_t find_island_root(std::vector<size_t>& parents, size_t idx) {
+    while (parents[idx] != idx) {
+        parents[idx] = parents[parents[idx]];
+        idx = parents[idx];
+    }
+    return idx;
+}
+
+/**
+ * \brief Evaluates island nodes in topological order without modifying the model.
+ *
+ * \param island  Island nodes in topological order.
+ *
+ * \return Folded outputs per island node, empty OutputVector if node was not folded.
+ */
+std::vector<ov::OutputVector> fold_island(const ov::NodeVector& island) {
+    std::vector<ov::OutputVector> folded(island.size());
+    std::unordered_map<const ov::Node*, size_t> positions;
+    for (size_t i = 0; i < island.size(); ++i) {
+        const auto& node = island[i];
+        bool inputs_ready = true;
+        ov::OutputVector input_values;
+        input_values.reserve(node->get_input_size());
+        for (const auto& input_value : node->input_values()) {
+            const auto it = positions.find(input_value.get_node());
+            if (it == positions.end()) {
+                input_values.push_back(input_value);
+            } else if (!folded[it->second].empty()) {
+                input_values.push_back(folded[it->second][input_value.get_index()]);
+            } else {
+                inputs_ready = false;
+                break;
+            }
+        }
+        positions.emplace(node.get(), i);
+        if (!inputs_ready || !node->can_constant_fold(input_values)) {
+            continue;
+        }
+        ov::OutputVector replacements(node->get_output_size());
+        if (node->constant_fold(replacements, input_values) &&
+            std::all_of(replacements.begin(), replacements.end(), [](const ov::Output<ov::Node>& output) {
+                return ov::op::util::is_constant(output.get_node());
+            })) {
+            folded[i] = std::move(replacements);
+        }
+    }
+    return folded;
+}
+}  // namespace
+
+bool ov::pass::ConstantFolding::concurrent_islands_folding(const std::shared_ptr<ov::Model>& model) {
+    auto nodes = model->get_ordered_ops();
+
+    // Union-find over candidates: nodes connected through foldable edges belong to the same island.
+    constexpr auto not_candidate = std::numeric_limits<size_t>::max();
+    std::unordered_map<const Node*, size_t> node_to_idx;
+    std::vector<size_t> parents(nodes.size(), not_candidate);
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        const auto& node = nodes[n];
+        node_to_idx.emplace(node.get(), n);
+        if (!is_island_candidate(node)) {
+            continue;
+        }
+        bool fed_by_constants = true;
+        std::vector<size_t> member_inputs;
+        for (const auto& input_value : node->input_values()) {
+            const auto input_node = input_value.get_node();
+            if (op::util::is_constant(input_node)) {
+                continue;
+            }
+            const auto it = node_to_idx.find(input_node);
+            if (it == node_to_idx.end() || parents[it->second] == not_candidate) {
+                fed_by_constants = false;
+                break;
+            }
+            member_inputs.push_back(it->second);
+        }
+        if (!fed_by_constants) {
+            continue;
+        }
+        parents[n] = n;
+        for (const auto member : member_inputs) {
+            parents[find_island_root(parents, member)] = n;
+        }
+    }
+
+    std::vector<NodeVector> islands;
+    std::unordered_map<size_t, size_t> root_to_island;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        if (parents[n] == not_candidate) {
+            continue;
+        }
+        const auto root = find_island_root(parents, n);
+        const auto island_it = root_to_island.emplace(root, islands.size()).first;
+        if (island_it->second == islands.size()) {
+            islands.emplace_back();
+        }
+        islands[island_it->second].push_back(nodes[n]);
+    }
+    nodes.clear();
+    node_to_idx.clear();
+
+    // Islands are processed in batches sized by the thread pool to bound the number of folded, but not yet
+    // inserted into the model, constants which coexist with the original ones.
+    const auto batch_size = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    bool rewritten = false;
+    for (size_t batch_begin = 0; batch_begin < islands.size(); batch_begin += batch_size) {
+        const auto batch_end = std::min(batch_begin + batch_size, islands.size());
+        std::vector<std::vector<OutputVector>> folded(batch_end - batch_begin);
+        ov::parallel_for(folded.size(), [&](size_t i) {
+            folded[i] = fold_island(islands[batch_begin + i]);
+        });
+
+        for (size_t i = 0; i < folded.size(); ++i) {
+            auto& island = islands[batch_begin + i];
+            std::vector<std::shared_ptr<op::v0::Constant>> sources;
+            for (size_t j = 0; j < island.size(); ++j) {
+                const auto& original_node = island[j];
+                if (folded[i][j].empty()) {
+                    continue;
+                }
+                OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
+                                "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                                original_node);
+                OPENVINO_ASSERT(folded[i][j].size() == original_node->get_output_size(),
+                                "constant_fold_default returned incorrect number of replacements for ",
+                                original_node);
+                for (const auto& input_value : original_node->input_values()) {
+                    if (auto constant = ov::as_type_ptr<op::v0::Constant>(input_value.get_node_shared_ptr())) {
+                        sources.push_back(std::move(constant));
+                    }
+                }
+                rewritten = replace_with_folded_outputs(original_node, folded[i][j]) || rewritten;
+                folded[i][j].clear();
+            }
+            // Evict source data as soon as island is folded if nothing else reads it
+            for (const auto& source : sources) {
+                const auto& outputs = source->outputs();
+                if (std::all_of(outputs.begin(), outputs.end(), [](const Output<Node>& output) {
+                        return output.get_target_inputs().empty();
+                    })) {
+                    ov::wsh::Extension::hint_evict(*source);
+                }
+            }
+            island.clear();
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
@@ -17,6 +17,8 @@
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
@@ -52,6 +54,29 @@ inline void convert_py_rt_info(std::shared_ptr<ov::Model> model) {
     ov::pass::ConvertLegacyPrecisionAttribute().run_on_model(model);
 }
 
+void collect_constant_blobs(const ov::Model& model, std::vector<std::pair<const char*, size_t>>& blobs) {
+    for (const auto& node : model.get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+            // fp16 compressed constants are hashed after the compression, string ones are packed on write
+            if (constant->get_element_type() != ov::element::string &&
+                !ov::is_fp16_compression_postponed(constant->get_rt_info()) && constant->get_byte_size() != 0) {
+                blobs.emplace_back(static_cast<const char*>(constant->get_data_ptr()), constant->get_byte_size());
+            }
+        } else if (const auto sub_graph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+            for (const auto& body : sub_graph->get_functions()) {
+                collect_constant_blobs(*body, blobs);
+            }
+        }
+    }
+}
+
+// Constants are hashed in parallel before the model is visited, so the serializer only writes them in order
+void precompute_constant_hashes(const ov::Model& model, ov::util::ConstantWriter& constant_writer) {
+    std::vector<std::pair<const char*, size_t>> blobs;
+    collect_constant_blobs(model, blobs);
+    constant_writer.precompute_hashes(blobs);
+}
+
 void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
@@ -78,6 +103,7 @@ void serialize_func(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
+    precompute_constant_hashes(*model, constant_writer);
     ov::util::XmlSerializer
         visitor(net_node, name, constant_writer, version, deterministic, false, ov::element::dynamic, false);
     visitor.on_attribute(name, model);
@@ -91,8 +117,9 @@ void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
                     ov::pass::Serialize::Version ver,
+                    size_t constants_alignment = 0,
                     bool deterministic = false) {
-    ov::util::ConstantWriter constant_write_handler(bin_file);
+    ov::util::ConstantWriter constant_write_handler(bin_file, true, constants_alignment);
     serialize_func(xml_file, bin_file, std::move(model), ver, deterministic, constant_write_handler);
 }
 
@@ -110,13 +137,17 @@ void handle_file_serialize_error(const std::filesystem::path& xml_path,
 namespace ov {
 bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_FUNCTION_SCOPE(Serialize);
+    return serialize(model, 0);
+}
+
+bool pass::Serialize::serialize(const std::shared_ptr<ov::Model>& model, size_t constants_alignment) {
     OPENVINO_ASSERT(model, "ov::Model not provided");
 
     model->validate_nodes_and_infer_types();
     convert_py_rt_info(model);
 
     if (m_xml_file && m_bin_file) {
-        serialize_func(*m_xml_file, *m_bin_file, model, m_version);
+        serialize_func(*m_xml_file, *m_bin_file, model, m_version, constants_alignment);
     } else {
         ov::util::create_directory_recursive(m_xml_path.parent_path());
 
@@ -130,7 +161,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         xml_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            serialize_func(xml_file, bin_file, model, m_version, constants_alignment);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -165,6 +196,25 @@ pass::Serialize::Serialize(const std::filesystem::path& xml_path,
     validate_xml_path(m_xml_path);
 }
 
+bool pass::AlignedSerialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_FUNCTION_SCOPE(AlignedSerialize);
+    return serialize(model, m_constants_alignment);
+}
+
+pass::AlignedSerialize::AlignedSerialize(std::ostream& xml_file,
+                                         std::ostream& bin_file,
+                                         size_t constants_alignment,
+                                         Version version)
+    : Serialize(xml_file, bin_file, version),
+      m_constants_alignment{constants_alignment} {}
+
+pass::AlignedSerialize::AlignedSerialize(const std::filesystem::path& xml_path,
+                                         const std::filesystem::path& bin_path,
+                                         size_t constants_alignment,
+                                         Version version)
+    : Serialize(xml_path, bin_path, version),
+      m_constants_alignment{constants_alignment} {}
+
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        const std::function<void(std::ostream&)>& custom_data_serializer,
                                        const std::function<std::string(const std::string&)>& cache_encrypt,
@@ -227,6 +277,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     auto constant_write_handler = util::ConstantWriter(m_stream);
+    precompute_constant_hashes(*model, constant_write_handler);
     const auto visitor = make_serializer(net_node, name, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor->on_attribute(name, fun);
@@ -4,41 +4,86 @@
 
 #include "openvino/xml_util/constant_writer.hpp"
 
+#include <algorithm>
+#include <array>
+
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/common_util.hpp"
 
 namespace ov::util {
 
-ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
+namespace {
+// Elements are converted to fp16 by blocks in parallel, the block is big enough to amortize the scheduling
+constexpr size_t fp16_conversion_block = 64 * 1024;
+}  // namespace
+
+ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression, size_t data_alignment)
     : m_hash_to_file_positions{},
       m_binary_output(bin_data),
       m_enable_compression(enable_compression),
       m_blob_offset(bin_data.tellp()),
-      m_data_hash{} {}
+      m_data_hash{},
+      m_data_alignment(data_alignment) {}
 
 ConstantWriter::~ConstantWriter() = default;
 
+void ConstantWriter::precompute_hashes(const std::vector<std::pair<const char*, size_t>>& blobs) {
+    if (!m_enable_compression) {
+        return;
+    }
+    std::vector<HashValue> hashes(blobs.size());
+    // compute_hash is sequential for a single blob, so the blobs are hashed concurrently
+    ov::parallel_for(blobs.size(), [&](size_t i) {
+        hashes[i] = ov::runtime::compute_hash(blobs[i].first, blobs[i].second);
+    });
+    for (size_t i = 0; i < blobs.size(); ++i) {
+        m_precomputed_hashes[blobs[i].first] = {blobs[i].second, hashes[i]};
+    }
+}
+
+ConstantWriter::HashValue ConstantWriter::get_hash(const char* ptr, size_t size) {
+    const auto found = m_precomputed_hashes.find(ptr);
+    if (found != m_precomputed_hashes.end() && found->second.first == size) {
+        return found->second.second;
+    }
+    return ov::runtime::compute_hash(ptr, size);
+}
+
+void ConstantWriter::align_output(size_t size) {
+    if (m_data_alignment == 0 || size < m_data_alignment) {
+        return;
+    }
+    const auto offset = static_cast<size_t>(m_binary_output.get().tellp() - m_blob_offset);
+    auto padding = (m_data_alignment - offset % m_data_alignment) % m_data_alignment;
+    static const std::array<char, 4096> zeros{};
+    while (padding > 0) {
+        const auto chunk = std::min(padding, zeros.size());
+        m_binary_output.get().write(zeros.data(), chunk);
+        padding -= chunk;
+    }
+}
+
 ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    size_t size,
                                                    size_t& new_size,
                                                    bool compress_to_fp16,
                                                    ov::element::Type src_type,
                                                    bool ptr_is_temporary) {
-    const FilePosition write_pos = m_binary_output.get().tellp();
-    const auto offset = write_pos - m_blob_offset;
     new_size = size;
 
     const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
     const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
 
+    HashValue hash = 0;
     if (m_enable_compression) {
         // This hash is weak (but efficient). For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        hash = compress_to_fp16 ? ov::runtime::compute_hash(data_ptr, new_size) : get_hash(data_ptr, new_size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
@@ -47,6 +92,13 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                 return it->second.first;
             }
         }
+    }
+
+    align_output(new_size);
+    const FilePosition write_pos = m_binary_output.get().tellp();
+    const auto offset = write_pos - m_blob_offset;
+
+    if (m_enable_compression) {
         if (!ptr_is_temporary) {
             // Since fp16_compressed data will be disposed at exit point and since we cannot reread it from the
             // ostream, we store pointer to the original uncompressed blob.
@@ -85,6 +137,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
         // Cache miss: store the packed buffer so its pointer stays valid for future memcmp
         m_packed_string_data.push_back(std::move(tmp));
         const char* stable_ptr = m_packed_string_data.back().data();
+        align_output(new_size);
         const FilePosition write_pos = m_binary_output.get().tellp();
         const FilePosition offset = write_pos - m_blob_offset;
         m_hash_to_file_positions.insert({hash, {offset, static_cast<const void*>(stable_ptr)}});
@@ -92,6 +145,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
         m_binary_output.get().write(stable_ptr, new_size);
         return offset;
     } else {
+        align_output(new_size);
         const FilePosition write_pos = m_binary_output.get().tellp();
         const FilePosition offset = write_pos - m_blob_offset;
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
@@ -113,7 +167,12 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
         auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
         auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const float*>(ptr);
-        ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
+        const auto blocks = (num_src_elements + fp16_conversion_block - 1) / fp16_conversion_block;
+        ov::parallel_for(blocks, [&](size_t block) {
+            const auto start = block * fp16_conversion_block;
+            const auto count = std::min(fp16_conversion_block, num_src_elements - start);
+            ov::reference::convert_from_f32_to_f16_with_clamp(src_data + start, dst_data + start, count);
+        });
         return new_ptr;
     } else if (src_type == ov::element::f64) {
         auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
@@ -121,7 +180,7 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
         auto src_data = reinterpret_cast<const double*>(ptr);
 
         // Reference implementation for fp64 to fp16 conversion
-        for (size_t i = 0; i < num_src_elements; ++i) {
+        ov::parallel_for(num_src_elements, [&](size_t i) {
             // if abs value is smaller than the smallest positive fp16, but not zero
             if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
                 dst_data[i] = 0;
@@ -132,7 +191,7 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
             } else {
                 dst_data[i] = static_cast<ov::float16>(src_data[i]);
             }
-        }
+        });
         return new_ptr;
     } else {
         OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
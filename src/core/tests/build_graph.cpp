@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <unordered_map>
 
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/node_builders/broadcast.hpp"
@@ -133,6 +134,31 @@ TEST(build_graph, no_arg_construction) {
     ASSERT_EQ(add1->get_output_shape(0), Shape{7});
 }
 
+TEST(build_graph, topological_sort_deep_graph) {
+    constexpr size_t depth = 100000;
+    auto arg = make_shared<ov::op::v0::Parameter>(element::f32, Shape{7});
+    std::shared_ptr<Node> node = arg;
+    for (size_t i = 0; i < depth; ++i) {
+        // diamonds make the nodes reachable by several paths
+        auto abs = make_shared<op::v0::Abs>(node);
+        auto relu = make_shared<op::v0::Relu>(node);
+        node = make_shared<op::v1::Add>(abs, relu);
+    }
+    auto model = make_shared<Model>(node, ParameterVector{arg});
+
+    const auto ops = model->get_ordered_ops();
+    ASSERT_EQ(ops.size(), 3 * depth + 2);
+    std::unordered_map<Node*, size_t> position;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        position[ops[i].get()] = i;
+    }
+    for (const auto& op : ops) {
+        for (const auto& input : op->input_values()) {
+            ASSERT_LT(position.at(input.get_node()), position.at(op.get()));
+        }
+    }
+}
+
 TEST(build_graph, multi_output_split_dynamic) {
     const auto data = make_shared<ov::op::v0::Parameter>(element::f32, PartialShape::dynamic());
     const auto axis = op::v0::Constant::create(element::i64, Shape{}, {1});
@@ -4023,6 +4023,66 @@ TEST(constant_folding, sq_diff) {
     ASSERT_NE(res_node, nullptr);
 }
 
+TEST(constant_folding, concurrent_islands) {
+    // Two disjoint constant sub-graphs feeding a non-foldable consumer
+    auto make_island = [](float value, const std::string& name) {
+        auto weights = op::v0::Constant::create(element::f32, Shape{2, 2}, {value});
+        weights->set_friendly_name(name + "_weights");
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {2});
+        scale->set_friendly_name(name + "_scale");
+        auto multiply = make_shared<op::v1::Multiply>(weights, scale);
+        multiply->set_friendly_name(name + "_multiply");
+        auto transpose =
+            make_shared<op::v1::Transpose>(multiply, op::v0::Constant::create(element::i64, Shape{2}, {1, 0}));
+        transpose->set_friendly_name(name);
+        return transpose;
+    };
+    auto param = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+    auto matmul_0 = make_shared<op::v0::MatMul>(param, make_island(1, "island_0"));
+    auto matmul_1 = make_shared<op::v0::MatMul>(matmul_0, make_island(3, "island_1"));
+    auto model = make_shared<Model>(matmul_1, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<pass::ConcurrentConstantFolding>();
+    pass_manager.run_passes(model);
+
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Transpose>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(model), 2);
+
+    auto folded_0 = ov::as_type_ptr<op::v0::Constant>(matmul_0->get_input_node_shared_ptr(1));
+    auto folded_1 = ov::as_type_ptr<op::v0::Constant>(matmul_1->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(folded_0);
+    ASSERT_TRUE(folded_1);
+    EXPECT_EQ(folded_0->cast_vector<float>(), vector<float>(4, 2));
+    EXPECT_EQ(folded_1->cast_vector<float>(), vector<float>(4, 6));
+    check_names(folded_0, {"island_0", "island_0_multiply", "island_0_weights", "island_0_scale"}, "island_0", false);
+    check_names(folded_1, {"island_1", "island_1_multiply", "island_1_weights", "island_1_scale"}, "island_1", false);
+}
+
+TEST(constant_folding, concurrent_islands_leave_non_foldable_nodes) {
+    auto param = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto constant = op::v0::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto negative = make_shared<op::v0::Negative>(constant);
+    auto add = make_shared<op::v1::Add>(param, negative);
+    auto disabled = make_shared<op::v0::Abs>(op::v0::Constant::create(element::f32, Shape{2}, {-1, 1}));
+    pass::disable_constant_folding(disabled);
+    auto multiply = make_shared<op::v1::Multiply>(add, disabled);
+    auto model = make_shared<Model>(multiply, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConcurrentConstantFolding>();
+    pass_manager.run_passes(model);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Negative>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Abs>(model), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(model), 1);
+    auto folded = ov::as_type_ptr<op::v0::Constant>(add->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(folded);
+    EXPECT_EQ(folded->cast_vector<float>(), (vector<float>{-1, -2}));
+}
+
 class UnsupportedTypesTest : public testing::TestWithParam<element::Type> {};
 
 TEST_P(UnsupportedTypesTest, add_multiply) {
@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <numeric>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
@@ -444,3 +445,38 @@ TEST_F(SerializationConstantCompressionTest, IdenticalStringConstantsRoundTrip)
         }
     }
 }
+
+TEST_F(SerializationConstantCompressionTest, AlignedLargeConstants) {
+    constexpr size_t alignment = 4096;
+    const ov::Shape small_shape{3};
+    const ov::Shape large_shape{2, 1024};
+
+    std::vector<float> large_values(ov::shape_size(large_shape));
+    std::iota(large_values.begin(), large_values.end(), 0.f);
+
+    auto A = ov::op::v0::Constant::create(ov::element::i32, small_shape, {1, 2, 3});
+    auto B = ov::op::v0::Constant::create(ov::element::f32, large_shape, large_values);
+    auto C = ov::op::v0::Constant::create(ov::element::f32, large_shape, large_values);
+
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::AlignedSerialize(m_out_xml_path_1, m_out_bin_path_1, alignment).run_on_model(model);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    // the small constant isn't aligned, the large one is placed at the next page, its duplicate isn't written
+    ASSERT_EQ(file_size(bin_1), alignment + ov::shape_size(large_shape) * sizeof(float));
+
+    ov::Core core;
+    auto model_imported = core.read_model(m_out_xml_path_1, m_out_bin_path_1);
+
+    for (const auto& result : model_imported->get_results()) {
+        const auto c = std::dynamic_pointer_cast<ov::op::v0::Constant>(result->get_input_node_shared_ptr(0));
+        ASSERT_NE(c, nullptr);
+        if (c->get_element_type() == ov::element::f32) {
+            EXPECT_EQ(c->get_vector<float>(), large_values);
+        } else {
+            EXPECT_EQ(c->get_vector<int32_t>(), std::vector<int32_t>({1, 2, 3}));
+        }
+    }
+}
@@ -4,9 +4,12 @@
 
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 
+#include <iterator>
 #include <regex>
 #include <stack>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/memory_util.hpp"
@@ -937,15 +940,24 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         GenericLayerParams params;
     };
 
-    std::map<size_t /*layer-id*/, NodeParams> params;
+    // Layer ids are only looked up and never iterated in order, so hash maps reserved for the layer count are used
+    const auto layers = root.child("layers");
+    const auto layers_range = layers.children("layer");
+    const auto layers_count = static_cast<size_t>(std::distance(layers_range.begin(), layers_range.end()));
+
+    std::unordered_map<size_t /*layer-id*/, NodeParams> params;
+    params.reserve(layers_count);
 
     std::vector<size_t /*layer-id*/> outputs;
 
     std::vector<size_t> order;
-    std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    order.reserve(layers_count);
+    std::unordered_set<size_t> dfs_used_nodes;
+    dfs_used_nodes.reserve(layers_count);
+    std::unordered_map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    edges.reserve(layers_count);
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
+    FOREACH_CHILD (node, layers, "layer") {
         auto node_param = parse_generic_params(node);
         params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
@@ -998,7 +1010,8 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
     FunctionNodes func_nodes;
-    std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
+    std::unordered_map<size_t, std::shared_ptr<ov::Node>> id_to_node;
+    id_to_node.reserve(order.size());
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
     //  Following topological order create OpenVINO operations
@@ -6,11 +6,14 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <set>
 #include <streambuf>
 #include <string>
 
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -113,6 +116,77 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_from_stream) {
     stream.close();
 }
 
+TEST_P(OnnxFeMmapFixture, onnx_external_data_converted_model_cache) {
+    const auto source_path = filesystem::path(
+        test::utils::getModelFromTestModelZoo(string(TEST_ONNX_MODELS_DIRNAME) + "external_data/external_data.onnx"));
+    const auto model_dir = filesystem::path(test::utils::generateTestFilePrefix() + "_external_data");
+    const auto cache_path = model_dir / "cache";
+    const auto model_path = model_dir / "external_data.onnx";
+    const auto data_path = model_dir / "tensors_data" / "tensor.data";
+    filesystem::create_directories(data_path.parent_path());
+    filesystem::copy_file(source_path, model_path);
+    filesystem::copy_file(source_path.parent_path() / "tensors_data" / "tensor.data", data_path);
+
+    Core core;
+    core.set_property(enable_mmap(GetParam()));
+    // the cache directory is next to the model, its content must not change the key
+    core.set_property(cache_dir(cache_path.string()));
+    core.set_property(enable_converted_model_cache(true));
+    const auto count_entries = [&cache_path] {
+        size_t entries = 0;
+        for (const auto& entry : filesystem::directory_iterator(cache_path)) {
+            entries += entry.path().extension() == ".xml";
+        }
+        return entries;
+    };
+    const auto run = [](const shared_ptr<Model>& model, const vector<float>& expected) {
+        auto test_case = test::TestCase(model);
+        test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+        test_case.add_expected_output<float>(Shape{2, 2}, expected);
+        test_case.run();
+    };
+
+    // the first read converts the model and saves it, the IR reader sets the "version" of the cached one
+    auto model = core.read_model(model_path);
+    EXPECT_FALSE(model->has_rt_info("version"));
+    EXPECT_EQ(count_entries(), 1u);
+    run(model, {3.f, 6.f, 9.f, 12.f});
+
+    model = core.read_model(model_path);
+    EXPECT_TRUE(model->has_rt_info("version"));
+    EXPECT_EQ(count_entries(), 1u);
+    run(model, {3.f, 6.f, 9.f, 12.f});
+
+    // the model file is unchanged, but its external data is rewritten
+    model.reset();
+    {
+        const vector<float> data{2.f, 3.f, 4.f, 5.f};
+        ofstream stream{data_path, ios::out | ios::binary | ios::trunc};
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    }
+    filesystem::last_write_time(data_path, filesystem::last_write_time(data_path) + chrono::seconds(10));
+    model = core.read_model(model_path);
+    EXPECT_FALSE(model->has_rt_info("version"));
+    EXPECT_EQ(count_entries(), 2u);
+    run(model, {4.f, 7.f, 10.f, 13.f});
+
+    // a new external data file changes the size of the directory content
+    {
+        ofstream stream{model_dir / "tensors_data" / "unused.data", ios::out | ios::binary};
+        stream << "unused";
+    }
+    model = core.read_model(model_path);
+    EXPECT_FALSE(model->has_rt_info("version"));
+    EXPECT_EQ(count_entries(), 3u);
+
+    model = core.read_model(model_path);
+    EXPECT_TRUE(model->has_rt_info("version"));
+    EXPECT_EQ(count_entries(), 3u);
+    run(model, {4.f, 7.f, 10.f, 13.f});
+
+    filesystem::remove_all(model_dir);
+}
+
 TEST_P(OnnxFeMmapFixture, onnx_external_data_incorrect_size_exception) {
     try {
         const auto path = test::utils::getModelFromTestModelZoo(
@@ -24,6 +24,7 @@
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/log.hpp"
@@ -129,14 +130,23 @@ void translate_framework_node(const std::shared_ptr<FrameworkNode>& node,
         old_output->replace(new_output->port);
     }
 }
+
+// Last variants (if presented) are reserved for FE configuration: the boolean mmap flag optionally followed by
+// the map of properties
+size_t get_extra_variants_num(const std::vector<ov::Any>& variants) {
+    size_t num = variants.size() > 0 && variants[variants.size() - 1].is<ov::AnyMap>() ? 1 : 0;
+    if (variants.size() > num && variants[variants.size() - 1 - num].is<bool>()) {
+        ++num;
+    }
+    return num;
+}
 }  // namespace
 
 FrontEnd::FrontEnd() : m_op_translators(tensorflow::op::get_supported_ops()) {}
 
 /// \brief Check if FrontEndTensorflow can recognize model from given parts
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
-    // Last boolean flag in `variants` (if presented) is reserved for FE configuration
-    size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    size_t extra_variants_num = get_extra_variants_num(variants);
 
     // For TF1 models it can be a case of two input variants: input model and v1 checkpoints
     if (variants.size() != 1 + extra_variants_num)
@@ -189,10 +199,18 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 }
 
 ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const {
-    // Last boolean flag in `variants` (if presented) is reserved for FE configuration
-    size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    size_t extra_variants_num = get_extra_variants_num(variants);
     // Enable mmap by default
-    bool mmap_enabled = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : true;
+    bool mmap_enabled = true;
+    size_t prefetch_budget = VariablesIndex::default_prefetch_budget;
+    for (size_t i = variants.size() - extra_variants_num; i < variants.size(); ++i) {
+        if (variants[i].is<bool>()) {
+            mmap_enabled = variants[i].as<bool>();
+        } else if (const auto& properties = variants[i].as<ov::AnyMap>();
+                   properties.count(ov::variables_prefetch_budget.name())) {
+            prefetch_budget = static_cast<size_t>(properties.at(ov::variables_prefetch_budget.name()).as<uint64_t>());
+        }
+    }
 
     // For TF1 models it can be a case of two input variants: input model and v1 checkpoints
     constexpr auto err_msg =
@@ -215,7 +233,10 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
             return std::make_shared<InputModel>(std::make_shared<GraphIteratorProto>(model_path), m_telemetry);
         } else if (GraphIteratorSavedModel::is_supported(model_path)) {
             std::shared_ptr<GraphIteratorSavedModel> graph_iterator;
-            graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path, std::string("serve"), mmap_enabled);
+            graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path,
+                                                                       std::string("serve"),
+                                                                       mmap_enabled,
+                                                                       prefetch_budget);
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
                                                 graph_iterator->get_variables_index(),
@@ -226,7 +247,7 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
                                                 nullptr,
                                                 true);
         } else if (GraphIteratorMeta::is_supported(model_path)) {
-            auto graph_iterator = std::make_shared<GraphIteratorMeta>(model_path, mmap_enabled);
+            auto graph_iterator = std::make_shared<GraphIteratorMeta>(model_path, mmap_enabled, prefetch_budget);
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
                                                 graph_iterator->get_variables_index(),
@@ -270,7 +291,10 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
         } else if (GraphIteratorSavedModel::is_supported(model_path)) {
             const auto saved_model_tags = ov::util::path_to_string(checkpoints_or_tags);
             std::shared_ptr<GraphIteratorSavedModel> graph_iterator;
-            graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path, saved_model_tags, mmap_enabled);
+            graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path,
+                                                                       saved_model_tags,
+                                                                       mmap_enabled,
+                                                                       prefetch_budget);
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
                                                 graph_iterator->get_variables_index(),
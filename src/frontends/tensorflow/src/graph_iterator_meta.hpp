@@ -26,11 +26,15 @@ class GraphIteratorMeta : public GraphIteratorProto {
     HashTableKeysValuesMap m_hash_table_keys_map;
     HashTableKeysValuesMap m_hash_table_values_map;
     bool m_mmap_enabled;
+    size_t m_prefetch_budget;
 
 public:
-    GraphIteratorMeta(const std::filesystem::path& path, const bool mmap_enabled)
+    GraphIteratorMeta(const std::filesystem::path& path,
+                      const bool mmap_enabled,
+                      const size_t prefetch_budget = VariablesIndex::default_prefetch_budget)
         : m_metagraph_def(std::make_shared<::tensorflow::MetaGraphDef>()),
-          m_mmap_enabled(mmap_enabled) {
+          m_mmap_enabled(mmap_enabled),
+          m_prefetch_budget(prefetch_budget) {
         this->read_meta(path);
     }
 
@@ -80,7 +84,7 @@ private:
 
         auto varIndexPath = get_variables_index_name(model_path);
         if (ov::util::file_exists(varIndexPath)) {
-            m_variables_index = std::make_shared<VariablesIndex>(m_mmap_enabled);
+            m_variables_index = std::make_shared<VariablesIndex>(m_mmap_enabled, m_prefetch_budget);
             std::ifstream vi_stream{varIndexPath, std::ifstream::in | std::ifstream::binary};
             FRONT_END_GENERAL_CHECK(vi_stream && vi_stream.is_open(), "MetaGraph's variable index file does not exist");
             FRONT_END_GENERAL_CHECK(m_variables_index->read_variables(vi_stream, model_path, false),
@@ -28,11 +28,16 @@ class GraphIteratorSavedModel : public GraphIteratorProto {
     HashTableKeysValuesMap m_hash_table_keys_map;
     HashTableKeysValuesMap m_hash_table_values_map;
     bool m_mmap_enabled;
+    size_t m_prefetch_budget;
 
 public:
-    GraphIteratorSavedModel(const std::filesystem::path& path, const std::string& tags, const bool mmap_enabled)
+    GraphIteratorSavedModel(const std::filesystem::path& path,
+                            const std::string& tags,
+                            const bool mmap_enabled,
+                            const size_t prefetch_budget = VariablesIndex::default_prefetch_budget)
         : m_saved_model(std::make_shared<::tensorflow::SavedModel>()),
-          m_mmap_enabled(mmap_enabled) {
+          m_mmap_enabled(mmap_enabled),
+          m_prefetch_budget(prefetch_budget) {
         this->read_saved_model(path, tags);
     }
 
@@ -68,7 +73,7 @@ private:
 
         const auto varIndexPath = path / get_variables_index_name();
         if (ov::util::file_exists(varIndexPath)) {
-            m_variables_index = std::make_shared<VariablesIndex>(m_mmap_enabled);
+            m_variables_index = std::make_shared<VariablesIndex>(m_mmap_enabled, m_prefetch_budget);
             std::ifstream vi_stream{varIndexPath, std::ifstream::in | std::ifstream::binary};
             FRONT_END_GENERAL_CHECK(vi_stream && vi_stream.is_open(),
                                     "[TensorFlow Frontend] Saved Model's variable index file does not exist");
@@ -52,6 +52,9 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
             std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data() + entry.offset(),
                                                                               entry.size(),
                                                                               mapped_memory));
+    } else if (auto prefetched_data =
+                   var_index->get_prefetched_data(entry.shard_id(), entry.offset(), entry.size())) {
+        return std::make_shared<v0::Constant>(ov_type, shape, prefetched_data);
     } else {
         std::vector<T> var_data;
         var_data.resize(size);
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <fstream>
+#include <set>
 #include <string>
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -230,6 +233,7 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream,
             fullPath += ".";
             fullPath += suffix.data();
         }
+        m_data_files[shard].path = fullPath;
         if (m_mmap_enabled) {
             m_data_files[shard].mmap = load_mmap_object(fullPath);
             FRONT_END_GENERAL_CHECK(m_data_files[shard].mmap->data(), "Variable index data cannot be mapped");
@@ -241,9 +245,104 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream,
     }
 
     read_checkpointable_object_graph();
+    prefetch_variables();
     return true;
 }
 
+void VariablesIndex::prefetch_variables() {
+    m_prefetched_data.clear();
+    if (m_mmap_enabled || m_prefetch_budget == 0) {
+        return;
+    }
+
+    struct PrefetchItem {
+        int32_t shard_id;
+        int64_t offset;
+        int64_t size;
+        std::shared_ptr<ov::AlignedBuffer> data;
+    };
+
+    // Models with trackable object graph reference variables by checkpoint keys,
+    // otherwise all variables could be requested by RestoreV2
+    std::set<std::string> referenced;
+    for (const auto& item : m_variables_map) {
+        referenced.insert(item.second);
+    }
+
+    std::vector<PrefetchItem> items;
+    size_t total_size = 0;
+    for (const auto& item : m_variables_index) {
+        if (item.first.empty() || item.first == "_CHECKPOINTABLE_OBJECT_GRAPH" ||
+            (!referenced.empty() && referenced.count(item.first) == 0)) {
+            continue;
+        }
+        ::tensorflow::BundleEntryProto entry{};
+        // Broken entries are skipped here, they are reported when the variable is requested
+        if (!entry.ParseFromArray(item.second.data(), static_cast<int>(item.second.size())) ||
+            !entry.slices().empty() || entry.size() <= 0 || entry.offset() < 0 ||
+            m_data_files.count(entry.shard_id()) == 0) {
+            continue;
+        }
+        const auto size = static_cast<size_t>(entry.size());
+        if (size > m_prefetch_budget - total_size) {
+            continue;
+        }
+        total_size += size;
+        items.push_back({entry.shard_id(), entry.offset(), entry.size(), nullptr});
+    }
+    if (items.empty()) {
+        return;
+    }
+
+    // Each task reads a contiguous range of variables, so access inside of a shard stays sequential
+    std::sort(items.begin(), items.end(), [](const PrefetchItem& a, const PrefetchItem& b) {
+        return a.shard_id != b.shard_id ? a.shard_id < b.shard_id : a.offset < b.offset;
+    });
+    const size_t num_ranges = std::min(static_cast<size_t>(std::max(1, ov::parallel_get_max_threads())), items.size());
+    ov::parallel_for(num_ranges, [&](size_t range) {
+        const size_t start = items.size() * range / num_ranges;
+        const size_t end = items.size() * (range + 1) / num_ranges;
+        std::map<int32_t, std::ifstream> streams;
+        std::map<int32_t, uint64_t> file_sizes;
+        for (size_t i = start; i < end; ++i) {
+            auto& item = items[i];
+            try {
+                auto& stream = streams[item.shard_id];
+                if (!stream.is_open()) {
+                    const auto& path = m_data_files.at(item.shard_id).path;
+                    stream.open(path, std::ifstream::in | std::ifstream::binary);
+                    std::error_code ec;
+                    file_sizes[item.shard_id] = static_cast<uint64_t>(std::filesystem::file_size(path, ec));
+                    if (ec) {
+                        file_sizes[item.shard_id] = 0;
+                    }
+                }
+                const auto file_size = file_sizes[item.shard_id];
+                if (!stream.is_open() || static_cast<uint64_t>(item.size) > file_size ||
+                    static_cast<uint64_t>(item.offset) > file_size - static_cast<uint64_t>(item.size)) {
+                    continue;
+                }
+                auto data = std::make_shared<ov::AlignedBuffer>(static_cast<size_t>(item.size));
+                stream.seekg(item.offset, std::ios::beg);
+                stream.read(data->get_ptr<char>(), item.size);
+                if (stream) {
+                    item.data = std::move(data);
+                } else {
+                    stream.clear();
+                }
+            } catch (const std::exception&) {
+                // Variable is read on request
+            }
+        }
+    });
+
+    for (auto& item : items) {
+        if (item.data) {
+            m_prefetched_data[{item.shard_id, item.offset}] = std::move(item.data);
+        }
+    }
+}
+
 struct PtrNode {
     using SharedPtrNode = std::shared_ptr<PtrNode>;
 
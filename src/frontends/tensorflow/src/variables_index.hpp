@@ -9,6 +9,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "ov_tensorflow/saved_model.pb.h"
@@ -22,6 +23,7 @@ using HashTableKeysValuesMap = std::unordered_map<std::string, std::shared_ptr<o
 struct VIBlock;
 
 struct VariableStorage {
+    std::filesystem::path path;
     std::shared_ptr<std::ifstream> stream;
     std::shared_ptr<ov::MappedMemory> mmap;
 };
@@ -40,9 +42,21 @@ class VariablesIndex {
     std::map<std::string, std::string> m_variables_map;
     // Flag shows which file storage is using
     bool m_mmap_enabled = false;
+    // Maximum amount of variables data read ahead of translation
+    size_t m_prefetch_budget = 0;
+    // Variables data read ahead of translation, key is a pair of shard_id and offset
+    std::map<std::pair<int32_t, int64_t>, std::shared_ptr<ov::AlignedBuffer>> m_prefetched_data;
 
 public:
-    VariablesIndex(bool mmap_enabled = false) : m_mmap_enabled(mmap_enabled) {}
+    // Default maximum amount of variables data read ahead of translation
+    static constexpr size_t default_prefetch_budget = size_t{1} << 30;
+
+    /// \param mmap_enabled Flag shows variables data is mapped instead of read
+    /// \param prefetch_budget Maximum amount of variables data read ahead of translation in bytes, 0 disables
+    /// prefetching. Set by ov::variables_prefetch_budget property of read_model.
+    VariablesIndex(bool mmap_enabled = false, size_t prefetch_budget = default_prefetch_budget)
+        : m_mmap_enabled(mmap_enabled),
+          m_prefetch_budget(prefetch_budget) {}
     /// \brief Returns mmap_enabled state.
     /// \returns True if mmap is enabled, false otherwise
     bool is_mmap_enabled(void) const {
@@ -105,6 +119,20 @@ public:
         return result != m_data_files.end() ? result->second.stream : nullptr;
     }
 
+    /// \brief Returns variable data read ahead of translation, or nullptr in case it wasn't prefetched
+    /// \param shard_id Shard_id of the variable
+    /// \param offset Offset of the variable data in the shard
+    /// \param size Size of the variable data
+    /// \returns Valid shared_ptr with variable data or nullptr
+    std::shared_ptr<ov::AlignedBuffer> get_prefetched_data(const int32_t shard_id,
+                                                           const int64_t offset,
+                                                           const int64_t size) const {
+        auto result = m_prefetched_data.find({shard_id, offset});
+        return result != m_prefetched_data.end() && static_cast<int64_t>(result->second->size()) == size
+                   ? result->second
+                   : nullptr;
+    }
+
     /// \brief Returns shared pointer to a requested shard_id, or nullptr in case of shard_id isn't found
     /// \param shard_id Requested shard_id
     /// \returns Valid shared_ptr with MappedMemory or with nullptr if shard isn't found
@@ -171,6 +199,10 @@ private:
     void read_bundle_header();
     /// \brief Reads key=value map from stored _CHECKPOINTABLE_OBJECT_GRAPH variable
     void read_checkpointable_object_graph();
+    /// \brief Reads data of the referenced variables from all shards in parallel, until the prefetch budget
+    /// is exhausted. Variables which aren't prefetched are read on request. Used only if mmap is disabled,
+    /// mapped shards are read lazily by the OS.
+    void prefetch_variables();
 };
 
 }  // namespace tensorflow
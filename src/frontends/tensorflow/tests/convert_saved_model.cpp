@@ -6,6 +6,7 @@
 #include "conversion_with_reference.hpp"
 #include "gtest/gtest.h"
 #include "openvino/frontend/exception.hpp"
+#include "openvino/frontend/manager.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/gather.hpp"
@@ -13,7 +14,9 @@
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/op/subtract.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace std;
 using namespace ov;
@@ -169,6 +172,37 @@ TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMMAPCompare) {
     { model_ref = convert_model("saved_model_variables", nullptr, {}, {}, {}, {}, {}, true); }
 }
 
+TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMultiShardMMAPCompare) {
+    // without mmap the variables of all shards are read ahead of translation
+    { model = convert_model("saved_model_multi_shard", nullptr, {}, {}, {}, {}, {}, true); }
+    { model_ref = convert_model("saved_model_multi_shard"); }
+}
+
+namespace {
+// Converts the multi-shard SavedModel without mmap, with the given budget to read its variables ahead of translation
+std::shared_ptr<Model> convert_multi_shard_model(uint64_t prefetch_budget) {
+    ov::frontend::FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_FE);
+    const auto model_path = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                               "saved_model_multi_shard");
+    const auto input_model =
+        front_end->load({model_path, false, ov::AnyMap{ov::variables_prefetch_budget(prefetch_budget)}});
+    return front_end->convert(input_model);
+}
+}  // namespace
+
+TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMultiShardPrefetchDisabled) {
+    // all variables are read on request
+    { model = convert_multi_shard_model(0); }
+    { model_ref = convert_model("saved_model_multi_shard"); }
+}
+
+TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMultiShardPrefetchPartial) {
+    // each variable takes 4 KB, so two of them are read ahead and the others are read on request
+    { model = convert_multi_shard_model(10000); }
+    { model_ref = convert_model("saved_model_multi_shard"); }
+}
+
 TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelWithNumericalNames) {
     comparator.enable(FunctionsComparator::CmpValues::TENSOR_NAMES);
     // The test aims to check that model with only numerical names for operation
@@ -0,0 +1,29 @@
+# Copyright (C) 2018-2026 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import numpy as np
+import tensorflow as tf
+
+
+# Create the model with several variables stored in different shards
+class MultiShardVariables(tf.Module):
+  def __init__(self):
+    super(MultiShardVariables, self).__init__()
+    rng = np.random.default_rng(42)
+    self.vars = [tf.Variable(rng.random([4, 256], dtype=np.float32)) for _ in range(8)]
+  @tf.function(input_signature=[tf.TensorSpec([4, 256], tf.float32)])
+  def __call__(self, x):
+    for var in self.vars:
+      x = x * var
+    return {'test_output_name': x}
+
+module = MultiShardVariables()
+options = None
+if hasattr(tf.train.experimental, "MaxShardSizePolicy"):
+  # each variable takes 4 KB, so every shard keeps about two variables
+  options = tf.saved_model.SaveOptions(
+    experimental_sharding_callback=tf.train.experimental.MaxShardSizePolicy(max_shard_size=8 * 1024))
+tf.saved_model.save(module, os.path.join(sys.argv[1], "saved_model_multi_shard"), options=options)
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -23,7 +26,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from a multi-level queue: tasks are taken in the order of their
+ *        priority (see ov::threading::ScopedTaskPriority), tasks of the same priority are taken in FIFO order.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -32,6 +36,15 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Queueing delay statistics of the tasks of one priority
+     */
+    struct QueueingStatistics {
+        uint64_t tasks = 0;                        //!< Number of tasks taken from the queue
+        std::chrono::nanoseconds total_delay{0};  //!< Sum of the times the tasks spent in the queue
+        std::chrono::nanoseconds max_delay{0};    //!< Maximum time a task spent in the queue
+    };
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -59,6 +72,11 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Returns queueing delay statistics of the tasks submitted by `run()` per priority
+     */
+    std::map<ov::hint::Priority, QueueingStatistics> get_queueing_statistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
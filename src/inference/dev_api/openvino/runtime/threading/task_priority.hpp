@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file openvino/runtime/threading/task_priority.hpp
+ * @brief A header file for the priority of the tasks submitted to the task executors
+ */
+
+#pragma once
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief Returns the priority of the tasks submitted by the current thread.
+ *        Executors supporting priorities (e.g. ov::threading::CPUStreamsExecutor) take it into account
+ *        when the task is submitted by `run()`.
+ * @ingroup ov_dev_api_threading
+ * @return The priority set by the innermost ov::threading::ScopedTaskPriority, ov::hint::Priority::DEFAULT otherwise
+ */
+OPENVINO_RUNTIME_API ov::hint::Priority get_task_priority();
+
+/**
+ * @brief Sets the priority of the tasks submitted by the current thread for the lifetime of the object.
+ *        For example, a plugin submitting the pipeline of an inference request:
+ * @code
+ * {
+ *     ov::threading::ScopedTaskPriority priority{m_priority};
+ *     ov::IAsyncInferRequest::start_async();
+ * }
+ * @endcode
+ * @ingroup ov_dev_api_threading
+ */
+class OPENVINO_RUNTIME_API ScopedTaskPriority {
+public:
+    explicit ScopedTaskPriority(ov::hint::Priority priority);
+    ~ScopedTaskPriority();
+
+    ScopedTaskPriority(const ScopedTaskPriority&) = delete;
+    ScopedTaskPriority& operator=(const ScopedTaskPriority&) = delete;
+
+private:
+    ov::hint::Priority m_previous;
+};
+
+}  // namespace threading
+}  // namespace ov
@@ -993,6 +993,34 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to enable caching of models converted by frontends in `core.read_model`. Disabled by
+ * default.
+ * The converted model is stored in the `cache_dir` directory in IR format and is read from there on the next
+ * `core.read_model` call for the same model file, skipping the frontend conversion. The cache entry is identified by
+ * the model file path, size and modification time, the size and modification time of every file in the model
+ * directory and its subdirectories (e.g. ONNX external data), the frontend and the OpenVINO version.
+ * IR models, models read with extensions, models which are not regular files (e.g. TensorFlow SavedModel
+ * directories) and models in directories with more than 1024 files are not cached.
+ *
+ * value type: boolean
+ *   - True enable caching of converted models if `cache_dir` is set
+ *   - False disable caching of converted models
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_converted_model_cache{"ENABLE_CONVERTED_MODEL_CACHE"};
+
+/**
+ * @brief Read-write property to set the maximum amount of memory in bytes used to read the variables of a model in
+ * parallel ahead of the conversion in `core.read_model`. 1 GiB by default, 0 disables the read ahead.
+ * Only the variables read from files are affected, i.e. `enable_mmap` must be disabled. For the moment only
+ * TensorFlow Frontend supports the property (SavedModel and MetaGraph formats).
+ *
+ * value type: uint64_t
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> variables_prefetch_budget{"VARIABLES_PREFETCH_BUDGET"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -215,6 +215,8 @@ static const auto core_properties_names = ov::util::make_array(ov::cache_dir.nam
                                                                ov::cache_model_path.name(),
                                                                ov::cache_blob_id.name(),
                                                                ov::enable_mmap.name(),
+                                                               ov::enable_converted_model_cache.name(),
+                                                               ov::variables_prefetch_budget.name(),
                                                                ov::force_tbb_terminate.name());
 
 static const auto auto_batch_properties_names =
@@ -959,8 +961,12 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::filesystem:
         });
         const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
         compiled_model = load_model_from_cache(cache_content, plugin, parsed.m_config, {}, [&]() {
-            const auto model =
-                util::read_model(model_path, "", get_extensions_copy(), parsed.m_core_config.get_enable_mmap());
+            const auto model = util::read_model(model_path,
+                                                "",
+                                                get_extensions_copy(),
+                                                parsed.m_core_config.get_enable_mmap(),
+                                                {},
+                                                parsed.m_core_config.get_variables_prefetch_budget());
             return compile_model_and_cache(plugin, model, parsed.m_config, {}, cache_content);
         });
     } else {
@@ -1297,6 +1303,11 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::enable_converted_model_cache.name()) {
+        const auto flag = m_core_config.get_enable_converted_model_cache();
+        return decltype(ov::enable_converted_model_cache)::value_type(flag);
+    } else if (name == ov::variables_prefetch_budget.name()) {
+        return decltype(ov::variables_prefetch_budget)::value_type(m_core_config.get_variables_prefetch_budget());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1723,6 +1734,8 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         m_devices_cache_config = other.m_devices_cache_config;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
+    m_flag_enable_converted_model_cache = other.m_flag_enable_converted_model_cache;
+    m_variables_prefetch_budget = other.m_variables_prefetch_budget;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
@@ -1746,6 +1759,14 @@ void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_nam
     if (const auto cfg_entry = config.find(ov::enable_mmap.name()); cfg_entry != config.end()) {
         m_flag_enable_mmap = cfg_entry->second.as<bool>();
     }
+
+    if (const auto cfg_entry = config.find(ov::enable_converted_model_cache.name()); cfg_entry != config.end()) {
+        m_flag_enable_converted_model_cache = cfg_entry->second.as<bool>();
+    }
+
+    if (const auto cfg_entry = config.find(ov::variables_prefetch_budget.name()); cfg_entry != config.end()) {
+        m_variables_prefetch_budget = cfg_entry->second.as<uint64_t>();
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config, const std::string& device_name) {
@@ -1768,6 +1789,14 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+bool ov::CoreConfig::get_enable_converted_model_cache() const {
+    return m_flag_enable_converted_model_cache;
+}
+
+uint64_t ov::CoreConfig::get_variables_prefetch_budget() const {
+    return m_variables_prefetch_budget;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
@@ -1804,7 +1833,19 @@ std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::filesystem::path&
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "CoreImpl::read_model from file");
     auto local_core_config = m_core_config;
     local_core_config.set(properties, {});
-    return ov::util::read_model(model_path, bin_path, get_extensions_copy(), local_core_config.get_enable_mmap());
+    // converted models are stored as IR files, so the single file cache storage is not used
+    auto converted_model_cache_dir = local_core_config.get_enable_converted_model_cache()
+                                         ? local_core_config.get_cache_dir()
+                                         : std::filesystem::path{};
+    if (converted_model_cache_dir.extension() == ".bin") {
+        converted_model_cache_dir.clear();
+    }
+    return ov::util::read_model(model_path,
+                                bin_path,
+                                get_extensions_copy(),
+                                local_core_config.get_enable_mmap(),
+                                converted_model_cache_dir,
+                                local_core_config.get_variables_prefetch_budget());
 }
 
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& model,
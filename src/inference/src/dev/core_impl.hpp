@@ -48,6 +48,10 @@ public:
 
     bool get_enable_mmap() const;
 
+    bool get_enable_converted_model_cache() const;
+
+    uint64_t get_variables_prefetch_budget() const;
+
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin) const;
 
@@ -59,6 +63,8 @@ private:
     CacheConfig m_cache_config{};
     std::map<std::string, CacheConfig> m_devices_cache_config{};
     bool m_flag_enable_mmap{true};
+    bool m_flag_enable_converted_model_cache{false};
+    uint64_t m_variables_prefetch_budget{uint64_t{1} << 30};
 };
 
 struct Parsed {
@@ -4,7 +4,10 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -20,6 +23,7 @@
 #include "openvino/runtime/threading/cpu_streams_executor_internal.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
+#include "openvino/runtime/threading/task_priority.hpp"
 #include "openvino/runtime/threading/thread_local.hpp"
 
 namespace ov {
@@ -364,11 +368,10 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return has_tasks() || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        if (has_tasks()) {
+                            task = pop_task();
                         }
                     }
                     if (task) {
@@ -379,14 +382,52 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    static size_t queue_index(ov::hint::Priority priority) {
+        switch (priority) {
+        case ov::hint::Priority::HIGH:
+            return 0;
+        case ov::hint::Priority::LOW:
+            return 2;
+        default:
+            return 1;
+        }
+    }
+
+    void Enqueue(Task task, ov::hint::Priority priority) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues[queue_index(priority)].push({std::move(task), std::chrono::steady_clock::now()});
         }
         _queueCondVar.notify_one();
     }
 
+    // must be called under _mutex
+    bool has_tasks() const {
+        return std::any_of(_taskQueues.begin(), _taskQueues.end(), [](const std::queue<QueuedTask>& queue) {
+            return !queue.empty();
+        });
+    }
+
+    // must be called under _mutex, strict priority: a task is taken only if all higher priority queues are empty
+    Task pop_task() {
+        for (size_t level = 0; level < _taskQueues.size(); ++level) {
+            auto& queue = _taskQueues[level];
+            if (queue.empty()) {
+                continue;
+            }
+            auto queued = std::move(queue.front());
+            queue.pop();
+            const auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                                    queued.enqueue_time);
+            auto& statistics = _queueingStatistics[level];
+            statistics.tasks++;
+            statistics.total_delay += delay;
+            statistics.max_delay = std::max(statistics.max_delay, delay);
+            return std::move(queued.task);
+        }
+        return {};
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto& arena = stream._taskArena;
@@ -454,7 +495,13 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    struct QueuedTask {
+        Task task;
+        std::chrono::steady_clock::time_point enqueue_time;
+    };
+    // one FIFO queue per priority, from the highest priority to the lowest one
+    std::array<std::queue<QueuedTask>, 3> _taskQueues;
+    std::array<QueueingStatistics, 3> _queueingStatistics;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
@@ -524,6 +571,16 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
     }
 }
 
+std::map<ov::hint::Priority, CPUStreamsExecutor::QueueingStatistics> CPUStreamsExecutor::get_queueing_statistics()
+    const {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    std::map<ov::hint::Priority, QueueingStatistics> statistics;
+    for (const auto priority : {ov::hint::Priority::HIGH, ov::hint::Priority::MEDIUM, ov::hint::Priority::LOW}) {
+        statistics[priority] = _impl->_queueingStatistics[Impl::queue_index(priority)];
+    }
+    return statistics;
+}
+
 void CPUStreamsExecutor::execute(Task task) {
     _impl->Defer(std::move(task));
 }
@@ -532,7 +589,7 @@ void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), get_task_priority());
     }
 }
 
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/task_priority.hpp"
+
+namespace ov {
+namespace threading {
+
+namespace {
+thread_local ov::hint::Priority current_task_priority = ov::hint::Priority::DEFAULT;
+}  // namespace
+
+ov::hint::Priority get_task_priority() {
+    return current_task_priority;
+}
+
+ScopedTaskPriority::ScopedTaskPriority(ov::hint::Priority priority) : m_previous(current_task_priority) {
+    current_task_priority = priority;
+}
+
+ScopedTaskPriority::~ScopedTaskPriority() {
+    current_task_priority = m_previous;
+}
+
+}  // namespace threading
+}  // namespace ov
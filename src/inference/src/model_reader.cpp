@@ -4,11 +4,20 @@
 
 #include "model_reader.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <thread>
+
 #include "itt.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/core/version.hpp"
 #include "openvino/frontend/manager.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/compilation_context.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
@@ -108,6 +117,130 @@ void update_v10_model(std::shared_ptr<ov::Model>& model, bool frontendMode = fal
         model = prepost.build();
     }
 }
+
+// Upper bound of the files scanned next to the model file
+constexpr size_t max_model_dir_files = 1024;
+
+// Returns the file info of every file in the directory of the model (recursively, except the cache directory).
+// A model file may refer to other files, e.g. ONNX external data, which are read from its directory or
+// subdirectories, and their modification must invalidate the converted model.
+// Returns nullopt if the directory can't be listed or holds too many files to be checked on every read.
+std::optional<std::string> get_model_dir_files_info(const std::filesystem::path& cache_dir,
+                                                    const std::filesystem::path& model_path) {
+    auto model_dir = model_path.parent_path();
+    if (model_dir.empty()) {
+        model_dir = ".";
+    }
+    std::error_code ec;
+    std::vector<std::pair<std::string, std::string>> files;
+    std::filesystem::recursive_directory_iterator it(model_dir,
+                                                     std::filesystem::directory_options::skip_permission_denied,
+                                                     ec);
+    for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        std::error_code entry_ec;
+        if (it->is_directory(entry_ec)) {
+            if (std::filesystem::equivalent(it->path(), cache_dir, entry_ec)) {
+                it.disable_recursion_pending();
+            }
+            continue;
+        }
+        if (!it->is_regular_file(entry_ec)) {
+            continue;
+        }
+        if (files.size() == max_model_dir_files) {
+            return std::nullopt;
+        }
+        files.emplace_back(ov::util::path_to_string(std::filesystem::relative(it->path(), model_dir, entry_ec)),
+                           ov::ModelCache::calculate_file_info(it->path()));
+    }
+    if (ec) {
+        return std::nullopt;
+    }
+    // the order of the directory iteration is unspecified
+    std::sort(files.begin(), files.end());
+    std::string info;
+    for (const auto& [name, file_info] : files) {
+        info += name + ":" + file_info + ";";
+    }
+    return info;
+}
+
+bool is_converted_model_cacheable(const std::filesystem::path& cache_dir,
+                                  const ov::frontend::FrontEnd::Ptr& FE,
+                                  const std::filesystem::path& model_path,
+                                  const std::vector<ov::Extension::Ptr>& extensions) {
+    // IR is read without conversion, extensions may change the conversion result in a way which can't be tracked,
+    // modification of directory based models (e.g. TF SavedModel) can't be detected by the directory file info
+    std::error_code ec;
+    return !cache_dir.empty() && FE->get_name() != "ir" && extensions.empty() &&
+           std::filesystem::is_regular_file(model_path, ec);
+}
+
+// Returns an empty path if the model can't be cached
+std::filesystem::path get_converted_model_path(const std::filesystem::path& cache_dir,
+                                               const ov::frontend::FrontEnd::Ptr& FE,
+                                               const std::filesystem::path& model_path,
+                                               const std::filesystem::path& bin_path) {
+    const auto model_dir_files_info = get_model_dir_files_info(cache_dir, model_path);
+    if (!model_dir_files_info) {
+        return {};
+    }
+    const ov::AnyMap source_info{
+        {"FRONTEND", FE->get_name()},
+        {"OPENVINO_VERSION", std::string{ov::get_openvino_version().buildNumber}},
+        {"MODEL_FILE_INFO", ov::ModelCache::calculate_file_info(model_path)},
+        {"WEIGHTS_FILE_INFO", bin_path.empty() ? std::string{} : ov::ModelCache::calculate_file_info(bin_path)},
+        {"MODEL_DIR_FILES_INFO", *model_dir_files_info}};
+    return cache_dir / ("converted_" + ov::ModelCache::compute_hash(model_path, source_info) + ".xml");
+}
+
+std::shared_ptr<ov::Model> read_converted_model(ov::frontend::FrontEndManager& manager,
+                                                const std::filesystem::path& xml_path,
+                                                bool enable_mmap) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "read_converted_model");
+    auto bin_path = xml_path;
+    bin_path.replace_extension(".bin");
+    std::error_code ec;
+    if (!std::filesystem::exists(xml_path, ec) || !std::filesystem::exists(bin_path, ec)) {
+        return nullptr;
+    }
+    try {
+        const auto FE = manager.load_by_framework("ir");
+        if (const auto inputModel = FE->load(ov::AnyVector{xml_path, bin_path, enable_mmap})) {
+            return FE->convert(inputModel);
+        }
+    } catch (const ov::Exception&) {
+        // corrupted or incompatible cache entry, the model is converted again
+    }
+    return nullptr;
+}
+
+void save_converted_model(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& xml_path) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "save_converted_model");
+    auto bin_path = xml_path;
+    bin_path.replace_extension(".bin");
+    // the entry is written to temporary files and renamed, so concurrent readers never see a partial entry;
+    // the XML file is renamed last as the IR reader requires both files
+    const auto tmp_suffix =
+        "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()) ^
+                             static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count())) +
+        ".tmp";
+    auto tmp_xml_path = xml_path;
+    tmp_xml_path += tmp_suffix;
+    auto tmp_bin_path = bin_path;
+    tmp_bin_path += tmp_suffix;
+    try {
+        ov::util::create_directory_recursive(xml_path.parent_path());
+        ov::pass::Serialize(tmp_xml_path, tmp_bin_path).run_on_model(model);
+        std::filesystem::rename(tmp_bin_path, bin_path);
+        std::filesystem::rename(tmp_xml_path, xml_path);
+    } catch (const std::exception&) {
+        // the cache is an optimization only, the converted model is returned anyway
+        std::error_code ec;
+        std::filesystem::remove(tmp_xml_path, ec);
+        std::filesystem::remove(tmp_bin_path, ec);
+    }
+}
 }  // namespace
 
 namespace ov {
@@ -116,7 +249,9 @@ namespace util {
 std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_path,
                                       const std::filesystem::path& bin_path,
                                       const std::vector<ov::Extension::Ptr>& extensions,
-                                      bool enable_mmap) {
+                                      bool enable_mmap,
+                                      const std::filesystem::path& converted_model_cache_dir,
+                                      std::optional<uint64_t> variables_prefetch_budget) {
     // Try to load with FrontEndManager
     ov::frontend::FrontEndManager manager;
     ov::frontend::FrontEnd::Ptr FE;
@@ -130,14 +265,31 @@ std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_path,
     params.emplace_back(enable_mmap);
 
     FE = manager.load_by_model(params);
+    std::filesystem::path converted_model_path;
+    if (FE && is_converted_model_cacheable(converted_model_cache_dir, FE, model_path, extensions)) {
+        converted_model_path = get_converted_model_path(converted_model_cache_dir, FE, model_path, bin_path);
+        if (!converted_model_path.empty()) {
+            if (auto model = read_converted_model(manager, converted_model_path, enable_mmap)) {
+                return model;
+            }
+        }
+    }
+
     if (FE) {
         FE->add_extension(extensions);
+        // the other frontends don't accept the properties map
+        if (variables_prefetch_budget && FE->get_name() == "tf") {
+            params.emplace_back(ov::AnyMap{{ov::variables_prefetch_budget.name(), *variables_prefetch_budget}});
+        }
         inputModel = FE->load(params);
     }
 
     if (inputModel) {
         auto model = FE->convert(inputModel);
         update_v10_model(model);
+        if (!converted_model_path.empty()) {
+            save_converted_model(model, converted_model_path);
+        }
         return model;
     }
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -22,12 +23,18 @@ namespace util {
  * if bin file with the same name was not found, will load IR without weights.
  * @param extensions vector with OpenVINO extensions
  * @param enable_mmap boolean to enable/disable `mmap` use in Frontend
+ * @param converted_model_cache_dir optional directory to cache models converted by frontends in IR format.
+ * If empty, models are always converted.
+ * @param variables_prefetch_budget optional maximum amount of memory in bytes used to read the model variables ahead of
+ * the conversion (see ov::variables_prefetch_budget). If not set, the Frontend default is used.
  * @return Shared pointer to ov::Model
  */
 std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_path,
                                       const std::filesystem::path& bin_path,
                                       const std::vector<ov::Extension::Ptr>& extensions,
-                                      bool enable_mmap);
+                                      bool enable_mmap,
+                                      const std::filesystem::path& converted_model_cache_dir = {},
+                                      std::optional<uint64_t> variables_prefetch_budget = std::nullopt);
 
 /**
  * @brief Reads model
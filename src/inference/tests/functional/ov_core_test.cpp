@@ -262,6 +262,36 @@ TEST_F(CoreBaseTest, read_model_rvalue_anymap_fs_path) {
     EXPECT_NE(model, nullptr);
 }
 
+TEST_F(CoreBaseTest, read_model_converted_model_cache_skips_ir) {
+    generate_test_model_files("test-model-converted-cache");
+    const auto cache_dir = std::filesystem::path(ov::test::utils::generateTestFilePrefix() + "_converted_cache");
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(cache_dir.string()));
+    core.set_property(ov::enable_converted_model_cache(true));
+    EXPECT_TRUE(core.get_property(ov::enable_converted_model_cache.name()).as<bool>());
+
+    const auto model = core.read_model(model_file_name, weight_file_name);
+    EXPECT_NE(model, nullptr);
+
+    // IR is read without conversion, so nothing is cached
+    EXPECT_TRUE(std::filesystem::is_empty(cache_dir));
+    std::filesystem::remove_all(cache_dir);
+}
+
+TEST_F(CoreBaseTest, read_model_variables_prefetch_budget) {
+    generate_test_model_files("test-model-prefetch-budget");
+
+    ov::Core core;
+    EXPECT_EQ(core.get_property(ov::variables_prefetch_budget.name()).as<uint64_t>(), uint64_t{1} << 30);
+    core.set_property(ov::variables_prefetch_budget(0));
+    EXPECT_EQ(core.get_property(ov::variables_prefetch_budget.name()).as<uint64_t>(), 0u);
+
+    // the budget is passed to the TensorFlow frontend only, IR is read as usual
+    const auto model = core.read_model(model_file_name, weight_file_name, {ov::variables_prefetch_budget(1024)});
+    EXPECT_NE(model, nullptr);
+}
+
 TEST_F(CoreBaseTest, compile_model_with_std_fs_path) {
     generate_test_model_files("model2");
 
@@ -11,6 +11,7 @@
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
+#include "openvino/runtime/threading/task_priority.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -263,3 +264,44 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorPriorityTests, tasksAreTakenInPriorityOrder) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::promise<void> blocker_started;
+    std::promise<void> release_blocker;
+    auto release_future = release_blocker.get_future().share();
+    // occupy the only stream, so the next tasks wait in the queue
+    auto blocker = async(executor, [&blocker_started, release_future] {
+        blocker_started.set_value();
+        release_future.wait();
+    });
+    blocker_started.get_future().wait();
+
+    std::mutex order_mutex;
+    std::vector<ov::hint::Priority> order;
+    std::vector<Future> futures;
+    for (const auto priority : {ov::hint::Priority::LOW, ov::hint::Priority::MEDIUM, ov::hint::Priority::HIGH}) {
+        ScopedTaskPriority task_priority{priority};
+        futures.push_back(async(executor, [&order_mutex, &order, priority] {
+            std::lock_guard<std::mutex> lock{order_mutex};
+            order.push_back(priority);
+        }));
+    }
+    ASSERT_EQ(get_task_priority(), ov::hint::Priority::DEFAULT);
+
+    release_blocker.set_value();
+    blocker.get();
+    for (auto& future : futures) {
+        future.get();
+    }
+    const std::vector<ov::hint::Priority> expected_order{ov::hint::Priority::HIGH,
+                                                         ov::hint::Priority::MEDIUM,
+                                                         ov::hint::Priority::LOW};
+    ASSERT_EQ(order, expected_order);
+
+    const auto statistics = executor->get_queueing_statistics();
+    ASSERT_EQ(statistics.at(ov::hint::Priority::HIGH).tasks, 1u);
+    ASSERT_EQ(statistics.at(ov::hint::Priority::MEDIUM).tasks, 2u);
+    ASSERT_EQ(statistics.at(ov::hint::Priority::LOW).tasks, 1u);
+    ASSERT_GE(statistics.at(ov::hint::Priority::LOW).max_delay, statistics.at(ov::hint::Priority::HIGH).max_delay);
+}
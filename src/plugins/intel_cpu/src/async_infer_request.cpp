@@ -9,16 +9,20 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "openvino/runtime/threading/task_priority.hpp"
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const std::shared_ptr<IInferRequest>& request,
     const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
     const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
-    const bool is_optimized_single_stream)
+    const bool is_optimized_single_stream,
+    const ov::hint::Priority priority)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
-      m_internal_request(request) {
+      m_internal_request(request),
+      m_priority(priority) {
     static_cast<SyncInferRequest*>(request.get())->set_async_request(this);
     m_stream_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(task_executor);
     m_infer_func = [this]() {
@@ -51,5 +55,12 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
 }
 
 void ov::intel_cpu::AsyncInferRequest::infer() {
+    ov::threading::ScopedTaskPriority task_priority{m_priority};
     m_infer_func();
 }
+
+void ov::intel_cpu::AsyncInferRequest::start_async() {
+    // the first pipeline stage is submitted to the task executor from the calling thread
+    ov::threading::ScopedTaskPriority task_priority{m_priority};
+    ov::IAsyncInferRequest::start_async();
+}
@@ -11,6 +11,7 @@
 #include "infer_request.h"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 
@@ -21,11 +22,14 @@ public:
     AsyncInferRequest(const std::shared_ptr<IInferRequest>& request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
-                      bool is_optimized_single_stream = false);
+                      bool is_optimized_single_stream = false,
+                      ov::hint::Priority priority = ov::hint::Priority::DEFAULT);
     ~AsyncInferRequest() override;
 
     void infer() override;
 
+    void start_async() override;
+
     void setSubInferRequest(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests);
 
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> getSubInferRequest() const {
@@ -43,6 +47,8 @@ public:
     std::shared_ptr<IInferRequest> m_internal_request;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor;
     std::function<void()> m_infer_func;
+    // priority of the request pipeline in the queue of the task executor
+    ov::hint::Priority m_priority;
 };
 
 }  // namespace ov::intel_cpu
@@ -25,8 +25,8 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const
+ * KeyType&) and erase(const KeyType&) interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -65,6 +65,15 @@ public:
         return {retVal, retStatus};
     }
 
+    /**
+     * @brief Removes the record associated with the key from the underlying storage, if any.
+     * @param key is the search key
+     */
+
+    void erase(const KeyType& key) {
+        _impl.erase(key);
+    }
+
     ImplType _impl;
 };
 
@@ -78,6 +78,19 @@ public:
         }
     }
 
+    /**
+     * @brief Removes the record associated with the key, if any.
+     * @param key
+     */
+
+    void erase(const Key& key) {
+        auto itr = _cacheMapper.find(key);
+        if (itr != _cacheMapper.end()) {
+            _lruList.erase(itr->second);
+            _cacheMapper.erase(itr);
+        }
+    }
+
     /**
      * @brief Returns the current capacity value
      * @return the current capacity value
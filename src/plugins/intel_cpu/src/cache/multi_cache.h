@@ -51,6 +51,15 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Removes the record of ValueType associated with the key from the cache, if any
+     * @param key is the search key
+     */
+    template <typename KeyType, typename ValueType>
+    void erase(const KeyType& key) {
+        getEntry<KeyType, ValueType>()->erase(key);
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
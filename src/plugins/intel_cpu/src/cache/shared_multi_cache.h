@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "cache_entry.h"
+#include "multi_cache.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Thread safe wrapper over MultiCache which can be shared between several graphs
+ * (e.g. between the streams of the same compiled model).
+ *
+ * The cache stores an in-flight record per key, so a value is built only once, and the builder runs outside
+ * the lock: builders of different keys run concurrently, while concurrent requests of the same key wait for
+ * the value. If the builder throws, the waiting requests build the value themselves without caching it and the failed
+ * record is removed, so the next request of the key builds and caches the value again.
+ */
+class SharedMultiCache {
+public:
+    explicit SharedMultiCache(size_t capacity) : m_cache(capacity) {}
+
+    template <typename KeyType,
+              typename BuilderType,
+              typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
+    typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+        using Record = std::shared_ptr<std::shared_future<ValueType>>;
+        std::promise<ValueType> promise;
+        Record created;
+        Record record;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            record = m_cache
+                         .getOrCreate(key,
+                                      [&](const KeyType&) {
+                                          created =
+                                              std::make_shared<std::shared_future<ValueType>>(promise.get_future());
+                                          return created;
+                                      })
+                         .first;
+        }
+
+        if (record != created) {
+            try {
+                return {record->get(), CacheEntryBase::LookUpStatus::Hit};
+            } catch (...) {
+                return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+            }
+        }
+
+        try {
+            ValueType value = builder(key);
+            promise.set_value(value);
+            return {std::move(value), CacheEntryBase::LookUpStatus::Miss};
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // the record may have been evicted and replaced by another request in the meantime
+            const auto stored = m_cache.getOrCreate(key, [](const KeyType&) { return Record(); }).first;
+            if (stored == created) {
+                m_cache.erase<KeyType, Record>(key);
+            }
+            throw;
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    MultiCache m_cache;
+};
+
+using SharedMultiCachePtr = std::shared_ptr<SharedMultiCache>;
+
+}  // namespace ov::intel_cpu
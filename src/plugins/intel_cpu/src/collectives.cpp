@@ -0,0 +1,291 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "collectives.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "graph_context.h"
+#include "nodes/common/cpu_memcpy.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/runtime/threading/cpu_message.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
+#    include <immintrin.h>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+// Elements are reduced by blocks to keep the work of a thread contiguous
+constexpr size_t reduce_block = 4096;
+
+template <typename Pred>
+void spin_wait(const Pred& pred) {
+    // The ranks are expected to arrive almost simultaneously, so busy waiting is cheaper than blocking.
+    // Yield the core if the wait takes too long to not starve the other streams on oversubscribed systems.
+    constexpr size_t spins_before_yield = 1024;
+    size_t spins = 0;
+    while (!pred()) {
+        if (++spins < spins_before_yield) {
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
+            _mm_pause();
+#endif
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void wait_counter(const std::atomic<uint64_t>& counter, uint64_t target) {
+    spin_wait([&]() {
+        return counter.load(std::memory_order_acquire) >= target;
+    });
+}
+
+template <typename T>
+void reduce_range(void* data, const std::vector<const void*>& srcs, size_t start, size_t end) {
+    auto* dst = static_cast<T*>(data);
+    if constexpr (std::is_same_v<T, float>) {
+        for (const auto* src : srcs) {
+            const auto* src_ptr = static_cast<const float*>(src);
+            for (size_t i = start; i < end; ++i) {
+                dst[i] += src_ptr[i];
+            }
+        }
+    } else {
+        // low precision values are accumulated in f32 to round the sum only once
+        std::array<float, reduce_block> acc;
+        for (size_t i = start; i < end; ++i) {
+            acc[i - start] = static_cast<float>(dst[i]);
+        }
+        for (const auto* src : srcs) {
+            const auto* src_ptr = static_cast<const T*>(src);
+            for (size_t i = start; i < end; ++i) {
+                acc[i - start] += static_cast<float>(src_ptr[i]);
+            }
+        }
+        for (size_t i = start; i < end; ++i) {
+            dst[i] = static_cast<T>(acc[i - start]);
+        }
+    }
+}
+
+// Accumulates `srcs` into the [offset, offset + part) range of `data`
+void reduce_part(void* data,
+                 const std::vector<const void*>& srcs,
+                 size_t offset,
+                 size_t part,
+                 ov::element::Type precision,
+                 const CpuParallel& cpu_parallel) {
+    using reduce_fn = void (*)(void*, const std::vector<const void*>&, size_t, size_t);
+    reduce_fn reduce = nullptr;
+    switch (precision) {
+    case ov::element::f32:
+        reduce = reduce_range<float>;
+        break;
+    case ov::element::bf16:
+        reduce = reduce_range<ov::bfloat16>;
+        break;
+    case ov::element::f16:
+        reduce = reduce_range<ov::float16>;
+        break;
+    default:
+        OPENVINO_THROW("Collectives do not support reduction of ", precision, " precision");
+    }
+
+    const auto blocks = (part + reduce_block - 1) / reduce_block;
+    cpu_parallel.parallel_for(blocks, [&](size_t block) {
+        const auto start = offset + block * reduce_block;
+        reduce(data, srcs, start, std::min(start + reduce_block, offset + part));
+    });
+}
+}  // namespace
+
+Communicator::Communicator(int size) : m_size(size), m_ranks(size) {
+    OPENVINO_ASSERT(size > 0, "Communicator size must be positive, got: ", size);
+    for (auto& slot : m_slots) {
+        slot.peers = std::vector<Peer>(size);
+    }
+}
+
+void Communicator::barrier(int rank) {
+    auto& sense = m_ranks[rank].sense;
+    sense = !sense;
+    if (m_barrier_count.fetch_add(1, std::memory_order_acq_rel) == m_size - 1) {
+        m_barrier_count.store(0, std::memory_order_relaxed);
+        m_barrier_sense.store(sense, std::memory_order_release);
+    } else {
+        spin_wait([&]() {
+            return m_barrier_sense.load(std::memory_order_acquire) == sense;
+        });
+    }
+}
+
+std::pair<Communicator::Slot*, uint64_t> Communicator::publish(int rank, const void* ptr, size_t row_bytes) {
+    const auto generation = m_ranks[rank].generation++;
+    auto& slot = m_slots[generation % m_slots.size()];
+    const auto use = generation / m_slots.size();
+    const auto size = static_cast<uint64_t>(m_size);
+    // The slot is reused: all the ranks must have finished reading its previous use
+    wait_counter(slot.released, size * use);
+
+    auto& peer = slot.peers[rank];
+    peer.ptr.store(ptr, std::memory_order_relaxed);
+    peer.row_bytes.store(row_bytes, std::memory_order_relaxed);
+    slot.published.fetch_add(1, std::memory_order_release);
+    wait_counter(slot.published, size * (use + 1));
+    return {&slot, use};
+}
+
+void Communicator::release(Slot& slot) {
+    slot.released.fetch_add(1, std::memory_order_release);
+}
+
+void Communicator::wait_released(int rank) const {
+    const auto generation = m_ranks[rank].generation;
+    if (generation == 0) {
+        return;
+    }
+    const auto& slot = m_slots[(generation - 1) % m_slots.size()];
+    const auto use = (generation - 1) / m_slots.size();
+    wait_counter(slot.released, static_cast<uint64_t>(m_size) * (use + 1));
+}
+
+std::pair<size_t, size_t> Communicator::get_part(int rank, size_t count) const {
+    const auto size = static_cast<size_t>(m_size);
+    const auto average = count / size;
+    const auto offset = average * static_cast<size_t>(rank);
+    return {offset, rank == m_size - 1 ? count - offset : average};
+}
+
+void Communicator::all_gather(int rank,
+                              const void* src,
+                              size_t src_row_bytes,
+                              void* dst,
+                              size_t rows,
+                              const CpuParallel& cpu_parallel) {
+    auto* slot = publish(rank, src, src_row_bytes).first;
+
+    std::vector<const uint8_t*> srcs(m_size);
+    std::vector<size_t> row_bytes(m_size);
+    std::vector<size_t> offsets(m_size);
+    size_t dst_row_bytes = 0;
+    for (int i = 0; i < m_size; ++i) {
+        srcs[i] = static_cast<const uint8_t*>(slot->peers[i].ptr.load(std::memory_order_relaxed));
+        row_bytes[i] = slot->peers[i].row_bytes.load(std::memory_order_relaxed);
+        offsets[i] = dst_row_bytes;
+        dst_row_bytes += row_bytes[i];
+    }
+
+    auto* dst_ptr = static_cast<uint8_t*>(dst);
+    cpu_parallel.parallel_for(rows, [&](size_t row) {
+        for (int i = 0; i < m_size; ++i) {
+            cpu_memcpy(dst_ptr + row * dst_row_bytes + offsets[i], srcs[i] + row * row_bytes[i], row_bytes[i]);
+        }
+    });
+
+    release(*slot);
+}
+
+std::pair<size_t, size_t> Communicator::reduce_scatter(int rank,
+                                                       void* data,
+                                                       size_t count,
+                                                       ov::element::Type precision,
+                                                       const CpuParallel& cpu_parallel) {
+    auto* slot = publish(rank, data, count * precision.size()).first;
+
+    size_t offset = 0;
+    size_t part = 0;
+    std::tie(offset, part) = get_part(rank, count);
+    std::vector<const void*> srcs;
+    for (int r = 0; r < m_size; ++r) {
+        if (r != rank) {
+            srcs.push_back(slot->peers[r].ptr.load(std::memory_order_relaxed));
+        }
+    }
+    reduce_part(data, srcs, offset, part, precision, cpu_parallel);
+
+    release(*slot);
+    return {offset, part};
+}
+
+void Communicator::all_reduce(int rank,
+                              void* src,
+                              void* dst,
+                              size_t count,
+                              ov::element::Type precision,
+                              const CpuParallel& cpu_parallel) {
+    if (m_size == 1) {
+        if (src != dst) {
+            cpu_memcpy(dst, src, count * precision.size());
+        }
+        return;
+    }
+
+    Slot* slot = nullptr;
+    uint64_t use = 0;
+    std::tie(slot, use) = publish(rank, src, count * precision.size());
+
+    // Reduce-scatter phase: the rank accumulates its own part only, so the ranks write disjoint parts
+    size_t offset = 0;
+    size_t part = 0;
+    std::tie(offset, part) = get_part(rank, count);
+    std::vector<const void*> srcs;
+    for (int r = 0; r < m_size; ++r) {
+        if (r != rank) {
+            srcs.push_back(slot->peers[r].ptr.load(std::memory_order_relaxed));
+        }
+    }
+    reduce_part(src, srcs, offset, part, precision, cpu_parallel);
+    slot->reduced.fetch_add(1, std::memory_order_release);
+    wait_counter(slot->reduced, static_cast<uint64_t>(m_size) * (use + 1));
+
+    // All-gather phase: the reduced parts are pulled from the source buffers of their owners
+    const auto element_size = precision.size();
+    cpu_parallel.parallel_for(static_cast<size_t>(m_size), [&](size_t r) {
+        if (static_cast<int>(r) == rank && src == dst) {
+            return;
+        }
+        const auto [r_offset, r_part] = get_part(static_cast<int>(r), count);
+        const auto* r_src = static_cast<const uint8_t*>(slot->peers[r].ptr.load(std::memory_order_relaxed));
+        cpu_memcpy(static_cast<uint8_t*>(dst) + r_offset * element_size,
+                   r_src + r_offset * element_size,
+                   r_part * element_size);
+    });
+
+    release(*slot);
+}
+
+TensorParallelConfig initTensorParallelConfig(const std::shared_ptr<const GraphContext>& context) {
+    TensorParallelConfig config;
+    const auto executor = context->getCPUStreamExecutor();
+    if (!executor) {
+        return config;
+    }
+    const auto rank = executor->get_rank();
+    if (!rank.empty()) {
+        config.w_rank = rank[0];
+        config.w_size = ov::threading::message_manager()->get_num_sub_streams();
+        config.enable_tensor_parallel = config.w_size > 1;
+        config.communicator = context->getSubMemory()->get_communicator();
+    }
+    return config;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+class CpuParallel;
+class GraphContext;
+
+/**
+ * @brief Intra-process collective operations between the sub-streams of tensor parallel compiled model.
+ * Each sub-stream participates with its own rank in [0, size). All the ranks must call the same collectives
+ * in the same order.
+ *
+ * The ranks exchange pointers to their buffers and every rank pulls the remote data into its own (NUMA-local)
+ * destination, so no intermediate staging copies are made.
+ * The synchronization is lock-free: the collectives use two slots of monotonic arrival counters, so a rank
+ * leaves the collective as soon as it has its result and may continue with the next node while the other ranks
+ * are still reading its buffer. Before the source buffer of the previous collective is overwritten,
+ * `wait_released` must be called.
+ */
+class Communicator {
+public:
+    explicit Communicator(int size);
+
+    [[nodiscard]] int size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Sense-reversing barrier
+     */
+    void barrier(int rank);
+
+    /**
+     * @brief Gathers `rows` rows of all the ranks into `dst` by columns: the row of rank i is placed right after
+     *        the row of rank i - 1. Row sizes may be different for the ranks.
+     * @param src source rows of the current rank, `src_row_bytes` each
+     * @param dst destination rows, the size of a row is a sum of `src_row_bytes` of all the ranks
+     */
+    void all_gather(int rank,
+                    const void* src,
+                    size_t src_row_bytes,
+                    void* dst,
+                    size_t rows,
+                    const CpuParallel& cpu_parallel);
+
+    /**
+     * @brief Sums `data` of all the ranks. Rank i gets the sum of i-th part of `count` elements in its `data`,
+     *        other parts are unchanged. f32, bf16 and f16 are supported, the sum is accumulated in f32.
+     * @return offset and count of elements which belong to the rank
+     */
+    std::pair<size_t, size_t> reduce_scatter(int rank,
+                                             void* data,
+                                             size_t count,
+                                             ov::element::Type precision,
+                                             const CpuParallel& cpu_parallel);
+
+    /**
+     * @brief Sums `src` of all the ranks into `dst`. The part of `src` which belongs to the rank is overwritten
+     *        with the sum, so `src` is expected to be a buffer private to the node and `dst` may be any memory
+     *        (even the same as `src`). f32, bf16 and f16 are supported, the sum is accumulated in f32.
+     */
+    void all_reduce(int rank,
+                    void* src,
+                    void* dst,
+                    size_t count,
+                    ov::element::Type precision,
+                    const CpuParallel& cpu_parallel);
+
+    /**
+     * @brief Waits until all the ranks finish reading the source buffer of the last collective of `rank`
+     */
+    void wait_released(int rank) const;
+
+    /**
+     * @brief Returns the part of `count` elements which belongs to `rank`
+     */
+    [[nodiscard]] std::pair<size_t, size_t> get_part(int rank, size_t count) const;
+
+private:
+    struct alignas(64) Peer {
+        std::atomic<const void*> ptr{nullptr};
+        std::atomic<size_t> row_bytes{0};
+    };
+
+    struct Slot {
+        std::vector<Peer> peers;
+        // monotonic counters of arrivals to the synchronization points
+        alignas(64) std::atomic<uint64_t> published{0};
+        alignas(64) std::atomic<uint64_t> reduced{0};
+        alignas(64) std::atomic<uint64_t> released{0};
+    };
+
+    struct alignas(64) RankState {
+        uint64_t generation = 0;
+        bool sense = false;
+    };
+
+    // Publishes buffer of the rank and waits for the buffers of all the others, returns slot and its use index
+    std::pair<Slot*, uint64_t> publish(int rank, const void* ptr, size_t row_bytes);
+    void release(Slot& slot);
+
+    const int m_size;
+    std::array<Slot, 2> m_slots;
+    std::vector<RankState> m_ranks;
+
+    alignas(64) std::atomic<int> m_barrier_count{0};
+    alignas(64) std::atomic<bool> m_barrier_sense{false};
+};
+
+/**
+ * @brief Tensor parallel configuration of a node executed by a sub-stream
+ */
+struct TensorParallelConfig {
+    int w_rank = -1;
+    int w_size = -1;
+    bool enable_tensor_parallel = false;
+    std::shared_ptr<Communicator> communicator = nullptr;
+};
+
+/**
+ * @brief Returns the tensor parallel configuration of the sub-stream the graph context belongs to.
+ * Tensor parallelism is disabled if the graph is not executed by the sub-streams.
+ */
+TensorParallelConfig initTensorParallelConfig(const std::shared_ptr<const GraphContext>& context);
+
+}  // namespace ov::intel_cpu
@@ -7,20 +7,26 @@
 #include <algorithm>
 #include <cstring>
 #include <exception>
+#include <iomanip>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
+#include <sstream>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/shared_multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
+#include "executor_tuning_cache.h"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "node_telemetry.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -31,9 +37,11 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "spin_worker_pool.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -53,6 +61,9 @@ using namespace ov::threading;
 
 namespace ov::intel_cpu {
 
+// model rt_info entry keeping the measured executor choices in the exported model
+static constexpr const char* executorChoicesRtInfoKey = "intel_cpu_executor_choices";
+
 struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -64,7 +75,6 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 CompiledModel::~CompiledModel() {
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
-        m_sub_memory_manager->_memorys_table.clear();
     }
     auto streamsExecutor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_task_executor);
     if (streamsExecutor) {
@@ -83,9 +93,23 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
+      m_request_priority(m_cfg.modelPriority),
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (m_cfg.snippetsCacheCapacity > 0) {
+        m_streams_snippets_code_cache = std::make_shared<SharedMultiCache>(m_cfg.snippetsCacheCapacity);
+    }
+    if (m_cfg.nodeTelemetrySamplingRate > 0) {
+        m_node_telemetry = std::make_shared<NodeTelemetry>(m_cfg.nodeTelemetrySamplingRate);
+    }
+    if (m_cfg.executorAutotuning) {
+        m_executor_tuning_cache = std::make_shared<ExecutorTuningCache>();
+        // restore the choices measured before the model was exported
+        if (m_model->has_rt_info(executorChoicesRtInfoKey)) {
+            m_executor_tuning_cache->deserialize(m_model->get_rt_info<std::string>(executorChoicesRtInfoKey));
+        }
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -201,13 +225,25 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                     std::lock_guard<std::mutex> lock{*m_mutex};
                     auto isQuantizedFlag = (m_cfg.lpTransformsMode == Config::On) &&
                                            ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
-                    auto cpuParallel = std::make_shared<CpuParallel>(m_cfg.tbbPartitioner);
+                    SpinWorkerPoolPtr workerPool = nullptr;
+                    if (m_cfg.spinWorkerPool) {
+                        // created on the stream thread, so the pool takes the stream concurrency and cores
+                        workerPool = std::make_shared<SpinWorkerPool>(parallel_get_max_threads(),
+                                                                      m_cfg.spinWorkerPoolSpinTime,
+                                                                      m_cfg.enableCpuPinning);
+                    }
+                    auto cpuParallel = std::make_shared<CpuParallel>(m_cfg.tbbPartitioner,
+                                                                     CpuParallel::default_multiplier,
+                                                                     workerPool);
                     ctx = std::make_shared<GraphContext>(m_cfg,
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_streams_snippets_code_cache,
+                                                         m_node_telemetry,
+                                                         m_executor_tuning_cache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -240,7 +276,8 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
                                             get_task_executor(),
                                             get_callback_executor(),
-                                            m_optimized_single_stream);
+                                            m_optimized_single_stream,
+                                            m_request_priority.load());
     if (m_has_sub_compiled_models) {
         std::vector<std::shared_ptr<IAsyncInferRequest>> requests;
         requests.reserve(m_sub_compiled_models.size());
@@ -265,6 +302,28 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
+    // The telemetry is read without graph locking, so it can be requested while the inference is running
+    if (name == ov::intel_cpu::node_telemetry) {
+        return decltype(ov::intel_cpu::node_telemetry)::value_type(m_node_telemetry ? m_node_telemetry->getReport()
+                                                                                      : "");
+    }
+    if (name == ov::intel_cpu::queueing_statistics) {
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(3);
+        if (const auto executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_task_executor)) {
+            for (const auto& [priority, statistics] : executor->get_queueing_statistics()) {
+                const auto average_us = statistics.tasks == 0 ? 0.0
+                                                              : static_cast<double>(statistics.total_delay.count()) /
+                                                                    static_cast<double>(statistics.tasks) / 1000.0;
+                report << priority << ";" << statistics.tasks << ";" << average_us << ";"
+                       << static_cast<double>(statistics.max_delay.count()) / 1000.0 << "\n";
+            }
+        }
+        return decltype(ov::intel_cpu::queueing_statistics)::value_type(report.str());
+    }
+    if (name == ov::hint::model_priority) {
+        return decltype(ov::hint::model_priority)::value_type(m_request_priority.load());
+    }
 
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
@@ -304,6 +363,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
             RO_property(ov::intel_cpu::tbb_partitioner.name()),
+            RO_property(ov::intel_cpu::node_telemetry.name()),
+            RO_property(ov::intel_cpu::queueing_statistics.name()),
+            ov::PropertyName(ov::hint::model_priority.name(), ov::PropertyMutability::RW),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
             RO_property(ov::hint::kv_cache_precision.name()),
             RO_property(ov::key_cache_precision.name()),
@@ -414,9 +476,39 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    // only the priority of the infer requests can be changed after the compilation
+    std::optional<ov::hint::Priority> priority;
+    for (const auto& [name, value] : properties) {
+        if (name != ov::hint::model_priority.name()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property ",
+                                           name,
+                                           " of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+        try {
+            priority = value.as<ov::hint::Priority>();
+        } catch (ov::Exception&) {
+            OPENVINO_THROW("Wrong value ",
+                           value.as<std::string>(),
+                           " for property key ",
+                           ov::hint::model_priority.name(),
+                           ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH");
+        }
+    }
+    if (priority) {
+        m_request_priority = *priority;
+    }
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
-    serializer << m_model;
+    // the measured choices go to the serialized copy, m_model is shared with the running streams
+    ov::AnyMap rt_info;
+    if (m_executor_tuning_cache && m_executor_tuning_cache->size() > 0) {
+        rt_info[executorChoicesRtInfoKey] = m_executor_tuning_cache->serialize();
+    }
+    serializer.serialize(m_model, rt_info);
 }
 
 void CompiledModel::release_memory() {
@@ -13,8 +13,11 @@
 #include <utility>
 #include <vector>
 
+#include "cache/shared_multi_cache.h"
 #include "config.h"
 #include "graph.h"
+#include "executor_tuning_cache.h"
+#include "node_telemetry.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -56,10 +59,7 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
@@ -82,6 +82,8 @@ private:
     Config m_cfg;
     mutable std::atomic_int m_numRequests = {0};
     std::string m_name;
+    // priority of the infer requests created afterwards, can be changed by set_property
+    std::atomic<ov::hint::Priority> m_request_priority;
 
     const bool m_loaded_from_cache;
     // WARNING: Do not use m_graphs directly.
@@ -100,6 +102,11 @@ private:
 
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
+    // Snippets kernels are generated once and reused by the graphs of all the streams
+    SharedMultiCachePtr m_streams_snippets_code_cache = nullptr;
+    // Sampled per-node telemetry collected by the graphs of all the streams
+    NodeTelemetryPtr m_node_telemetry = nullptr;
+    ExecutorTuningCachePtr m_executor_tuning_cache = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
 };
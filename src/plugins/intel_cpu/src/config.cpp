@@ -150,6 +150,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::scheduling_core_type.name(),
                                ". Expected only ov::hint::SchedulingCoreType::ANY_CORE/PCORE_ONLY/ECORE_ONLY");
             }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = val.as<ov::hint::Priority>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::hint::model_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH");
+            }
         } else if (key == ov::hint::model_distribution_policy.name()) {
             auto error_info = [&]() {
                 OPENVINO_THROW("Wrong value ",
@@ -316,6 +326,82 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::intel_cpu::snippets_mode.name(),
                                ". Expected values: ov::intel_cpu::SnippetsMode::ENABLE/DISABLE/IGNORE_CALLBACK");
             }
+        } else if (key == ov::intel_cpu::snippets_brgemm_tuning_db.name()) {
+            try {
+                snippetsBrgemmTuningDB = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::snippets_brgemm_tuning_db.name());
+            }
+        } else if (key == ov::intel_cpu::snippets_mha_rope_tokenization.name()) {
+            try {
+                snippetsMHARoPETokenization = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::snippets_mha_rope_tokenization.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::node_telemetry_sampling_rate.name()) {
+            try {
+                nodeTelemetrySamplingRate = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::node_telemetry_sampling_rate.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (key == ov::intel_cpu::concurrent_constant_folding.name()) {
+            try {
+                concurrentConstantFolding = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::concurrent_constant_folding.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::moe_op_fusion.name()) {
+            try {
+                moeOpFusion = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::moe_op_fusion.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::executor_autotuning.name()) {
+            try {
+                executorAutotuning = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::executor_autotuning.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::spin_worker_pool.name()) {
+            try {
+                spinWorkerPool = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::spin_worker_pool.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::spin_worker_pool_spin_time.name()) {
+            try {
+                spinWorkerPoolSpinTime = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::spin_worker_pool_spin_time.name(),
+                               ". Expected only non-negative integer numbers");
+            }
         } else if (key == ov::hint::execution_mode.name()) {
             try {
                 executionMode = val.as<ov::hint::ExecutionMode>();
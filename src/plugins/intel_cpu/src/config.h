@@ -73,6 +73,14 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    std::string snippetsBrgemmTuningDB;
+    bool snippetsMHARoPETokenization = false;
+    bool concurrentConstantFolding = false;
+    bool moeOpFusion = false;
+    uint32_t nodeTelemetrySamplingRate = 0;
+    bool executorAutotuning = false;
+    bool spinWorkerPool = false;
+    uint32_t spinWorkerPoolSpinTime = 50;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -101,6 +109,7 @@ struct Config {
     bool changedCpuPinning = false;
     bool enableCpuReservation = false;
     ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
     ov::intel_cpu::TbbPartitioner tbbPartitioner = ov::intel_cpu::TbbPartitioner::NONE;
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy;
     bool enableTensorParallel = false;
@@ -6,14 +6,17 @@
 
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "spin_worker_pool.hpp"
 #include "thread_pool_imp.hpp"
 
 namespace ov::intel_cpu {
-CpuParallel::CpuParallel(ov::intel_cpu::TbbPartitioner partitioner, size_t multiplier)
+CpuParallel::CpuParallel(ov::intel_cpu::TbbPartitioner partitioner, size_t multiplier, SpinWorkerPoolPtr worker_pool)
     : m_partitioner(partitioner),
-      m_multiplier(multiplier) {
+      m_multiplier(multiplier),
+      m_worker_pool(std::move(worker_pool)) {
     m_partitioner =
         m_partitioner == ov::intel_cpu::TbbPartitioner::NONE ? ov::intel_cpu::TbbPartitioner::STATIC : m_partitioner;
     if (ov::intel_cpu::TbbPartitioner::STATIC == m_partitioner) {
@@ -6,8 +6,14 @@
 
 #include <oneapi/dnnl/dnnl_threadpool.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "spin_worker_pool.hpp"
 
 namespace ov::intel_cpu {
 class ThreadPool;
@@ -21,7 +27,8 @@ public:
     CpuParallel() = delete;
     CpuParallel(CpuParallel&) = delete;
     CpuParallel(ov::intel_cpu::TbbPartitioner partitioner = ov::intel_cpu::TbbPartitioner::STATIC,
-                size_t multiplier = default_multiplier);
+                size_t multiplier = default_multiplier,
+                SpinWorkerPoolPtr worker_pool = nullptr);
     ~CpuParallel() = default;
 
     [[nodiscard]] ov::intel_cpu::TbbPartitioner get_partitioner() const {
@@ -33,7 +40,14 @@ public:
     [[nodiscard]] std::shared_ptr<ThreadPool> get_thread_pool() const {
         return m_thread_pool;
     }
+    // The regions are dispatched to the worker pool instead of TBB if it is set
+    [[nodiscard]] SpinWorkerPoolPtr get_worker_pool() const {
+        return m_worker_pool;
+    }
     [[nodiscard]] int get_num_threads() const {
+        if (m_worker_pool) {
+            return m_worker_pool->get_num_threads();
+        }
         int num = m_partitioner == ov::intel_cpu::TbbPartitioner::STATIC
                       ? parallel_get_max_threads()
                       : parallel_get_max_threads() * static_cast<int>(m_multiplier);
@@ -50,6 +64,10 @@ public:
 
     template <typename T0, typename F>
     void parallel_simple(const T0 D0, const F& func) const {
+        if (m_worker_pool) {
+            m_worker_pool->run(static_cast<int>(D0), func);
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         const auto nthr = D0;
         if (m_partitioner == ov::intel_cpu::TbbPartitioner::AUTO) {
@@ -114,8 +132,40 @@ public:
     }
 
 private:
+    // Static partitioning of the work over the pool threads, a thread gets at least one work item
+    [[nodiscard]] int pool_threads(size_t work_amount) const {
+        return static_cast<int>(std::min(work_amount, static_cast<size_t>(m_worker_pool->get_num_threads())));
+    }
+
+    template <typename F>
+    void pool_for(size_t work_amount, const F& func) const {
+        const int nthr = pool_threads(work_amount);
+        m_worker_pool->run(nthr, func);
+    }
+
+    template <typename R, typename F>
+    [[nodiscard]] R pool_sum(size_t work_amount, const R& input, const F& func) const {
+        const int nthr = pool_threads(work_amount);
+        std::vector<R> partial_sums(nthr, input);
+        m_worker_pool->run(nthr, [&](int ithr, int num_threads) {
+            func(ithr, num_threads, partial_sums[ithr]);
+        });
+        R res_sum = 0;
+        for (const auto& sum : partial_sums) {
+            res_sum += sum;
+        }
+        return res_sum;
+    }
+
     template <typename T0, typename R, typename F>
     [[nodiscard]] R cpu_parallel_sum(const T0& D0, const R& input, const F& func) const {
+        if (m_worker_pool) {
+            return pool_sum(static_cast<size_t>(D0), input, [&](int ithr, int nthr, R& sum) {
+                for_1d(ithr, nthr, D0, [&](T0 dim1) {
+                    sum += func(dim1);
+                });
+            });
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         R res_sum = 0;
         if (m_partitioner == ov::intel_cpu::TbbPartitioner::AUTO) {
@@ -156,6 +206,13 @@ private:
 
     template <typename T0, typename T1, typename R, typename F>
     [[nodiscard]] R cpu_parallel_sum2d(const T0& D0, const T1& D1, const R& input, const F& func) const {
+        if (m_worker_pool) {
+            return pool_sum(static_cast<size_t>(D0 * D1), input, [&](int ithr, int nthr, R& sum) {
+                for_2d(ithr, nthr, D0, D1, [&](T0 dim2, T1 dim1) {
+                    sum += func(dim2, dim1);
+                });
+            });
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         R res_sum = 0;
         if (m_partitioner == ov::intel_cpu::TbbPartitioner::AUTO) {
@@ -200,6 +257,13 @@ private:
 
     template <typename T0, typename T1, typename T2, typename R, typename F>
     [[nodiscard]] R cpu_parallel_sum3d(const T0& D0, const T1& D1, const T2& D2, const R& input, const F& func) const {
+        if (m_worker_pool) {
+            return pool_sum(static_cast<size_t>(D0 * D1 * D2), input, [&](int ithr, int nthr, R& sum) {
+                for_3d(ithr, nthr, D0, D1, D2, [&](T0 dim1, T1 dim2, T2 dim3) {
+                    sum += func(dim1, dim2, dim3);
+                });
+            });
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         R res_sum = 0;
         if (m_partitioner == ov::intel_cpu::TbbPartitioner::AUTO) {
@@ -248,6 +312,12 @@ private:
 
     template <typename T0, typename F>
     void cpu_parallel_for(const T0& D0, const F& func) const {
+        if (m_worker_pool) {
+            pool_for(static_cast<size_t>(D0), [&](int ithr, int nthr) {
+                for_1d(ithr, nthr, D0, func);
+            });
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto work_amount = static_cast<int>(D0);
         const int nthr = parallel_get_max_threads();
@@ -282,6 +352,12 @@ private:
 
     template <typename T0, typename T1, typename F>
     void cpu_parallel_for2d(const T0& D0, const T1& D1, const F& func) const {
+        if (m_worker_pool) {
+            pool_for(static_cast<size_t>(D0 * D1), [&](int ithr, int nthr) {
+                for_2d(ithr, nthr, D0, D1, func);
+            });
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto work_amount = static_cast<int>(D0 * D1);
         const int nthr = parallel_get_max_threads();
@@ -316,6 +392,12 @@ private:
 
     template <typename T0, typename T1, typename T2, typename F>
     void cpu_parallel_for3d(const T0& D0, const T1& D1, const T2& D2, const F& func) const {
+        if (m_worker_pool) {
+            pool_for(static_cast<size_t>(D0 * D1 * D2), [&](int ithr, int nthr) {
+                for_3d(ithr, nthr, D0, D1, D2, func);
+            });
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto work_amount = static_cast<int>(D0 * D1 * D2);
         const int nthr = parallel_get_max_threads();
@@ -350,6 +432,12 @@ private:
 
     template <typename T0, typename T1, typename T2, typename T3, typename F>
     void cpu_parallel_for4d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const F& func) const {
+        if (m_worker_pool) {
+            pool_for(static_cast<size_t>(D0 * D1 * D2 * D3), [&](int ithr, int nthr) {
+                for_4d(ithr, nthr, D0, D1, D2, D3, func);
+            });
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto work_amount = static_cast<int>(D0 * D1 * D2 * D3);
         const int nthr = parallel_get_max_threads();
@@ -384,6 +472,12 @@ private:
 
     template <typename T0, typename T1, typename T2, typename T3, typename T4, typename F>
     void cpu_parallel_for5d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const T4& D4, const F& func) const {
+        if (m_worker_pool) {
+            pool_for(static_cast<size_t>(D0 * D1 * D2 * D3 * D4), [&](int ithr, int nthr) {
+                for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
+            });
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto work_amount = static_cast<int>(D0 * D1 * D2 * D3 * D4);
         const int nthr = parallel_get_max_threads();
@@ -424,6 +518,12 @@ private:
                             const T4& D4,
                             const T5& D5,
                             const F& func) const {
+        if (m_worker_pool) {
+            pool_for(static_cast<size_t>(D0 * D1 * D2 * D3 * D4 * D5), [&](int ithr, int nthr) {
+                for_6d(ithr, nthr, D0, D1, D2, D3, D4, D5, func);
+            });
+            return;
+        }
 #if OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto work_amount = static_cast<int>(D0 * D1 * D2 * D3 * D4 * D5);
         const int nthr = parallel_get_max_threads();
@@ -459,6 +559,7 @@ private:
     ov::intel_cpu::TbbPartitioner m_partitioner = ov::intel_cpu::TbbPartitioner::STATIC;
     int m_multiplier = default_multiplier;
     std::shared_ptr<ThreadPool> m_thread_pool = nullptr;
+    SpinWorkerPoolPtr m_worker_pool = nullptr;
 };
 
 using CpuParallelPtr = std::shared_ptr<ov::intel_cpu::CpuParallel>;
@@ -256,6 +256,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"RoPE", Type::RoPE},
         {"GatherCompressed", Type::Gather},
         {"CausalMaskPreprocess", Type::CausalMaskPreprocess},
+        {"ImagePreprocess", Type::ImagePreprocess},
         {"EmbeddingBagPacked", Type::EmbeddingBagPacked},
         {"EmbeddingBagOffsets", Type::EmbeddingBagOffsets},
         {"LLMMLP", Type::LLMMLP},
@@ -265,6 +266,8 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"LoraSubgraph", Type::LoRA},
         {"GatherMatmul", Type::GatherMatmul},
         {"GatherMatmulCompressed", Type::GatherMatmul},
+        {"MOE", Type::MOE},
+        {"MOECompressed", Type::MOE},
         {"GatedDeltaNet", Type::GatedDeltaNet},
         {"PagedGatedDeltaNet", Type::PagedGatedDeltaNet},
         {"PagedCausalConv1D", Type::PagedCausalConv1D}};
@@ -397,6 +400,7 @@ std::string NameFromType(const Type type) {
         CASE(PaKVReorder);
         CASE(RoPE);
         CASE(CausalMaskPreprocess);
+        CASE(ImagePreprocess);
         CASE(LLMMLP);
         CASE(QKVProjection);
         CASE(RMS);
@@ -404,6 +408,7 @@ std::string NameFromType(const Type type) {
         CASE(SegmentMax);
         CASE(LoRA);
         CASE(GatherMatmul);
+        CASE(MOE);
         CASE(GatedDeltaNet);
         CASE(PagedGatedDeltaNet);
         CASE(PagedCausalConv1D);
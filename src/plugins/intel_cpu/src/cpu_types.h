@@ -133,6 +133,7 @@ enum class Type : uint8_t {
     PaKVReorder,
     RoPE,
     CausalMaskPreprocess,
+    ImagePreprocess,
     LLMMLP,
     QKVProjection,
     RMS,
@@ -140,6 +141,7 @@ enum class Type : uint8_t {
     SegmentMax,
     LoRA,
     GatherMatmul,
+    MOE,
     GatedDeltaNet,
     PagedGatedDeltaNet,
     PagedCausalConv1D
@@ -107,11 +107,6 @@ class BrgemmBaseKernelExecutor {
 public:
     virtual ~BrgemmBaseKernelExecutor() = default;
 
-protected:
-    static void update_config(const ov::snippets::lowered::ExpressionPtr& expr,
-                              const ov::snippets::lowered::LinearIRCPtr& linear_ir,
-                              BrgemmBaseKernelConfig& config);
-
     static void create_brgemm_kernel(std::shared_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>& kernel,
                                      dnnl_data_type_t dt_in0,
                                      dnnl_data_type_t dt_in1,
@@ -136,6 +131,11 @@ protected:
                                       const void* post_ops_binary_arg_vec,
                                       bool with_comp,
                                       bool apply_post_ops);
+
+protected:
+    static void update_config(const ov::snippets::lowered::ExpressionPtr& expr,
+                              const ov::snippets::lowered::LinearIRCPtr& linear_ir,
+                              BrgemmBaseKernelConfig& config);
 };
 
 }  // namespace ov::intel_cpu::x64
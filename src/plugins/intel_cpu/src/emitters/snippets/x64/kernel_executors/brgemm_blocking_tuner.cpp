@@ -0,0 +1,252 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "brgemm_blocking_tuner.hpp"
+
+#include <oneapi/dnnl/dnnl_common_types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <common/primitive_attr.hpp>
+#include <common/utils.hpp>
+#include <cpu/x64/brgemm/brgemm_types.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dnnl_extension_utils.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "snippets/utils/utils.hpp"
+
+#define DTYPE_CAST(X) static_cast<dnnl_data_type_t>(DnnlExtensionUtils::ElementTypeToDataType(X))
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov::intel_cpu::x64 {
+
+bool BrgemmTuningDB::Key::operator==(const Key& rhs) const {
+    return M == rhs.M && N == rhs.N && K == rhs.K && in0_type == rhs.in0_type && in1_type == rhs.in1_type &&
+           isa == rhs.isa && with_wei_repacking == rhs.with_wei_repacking && transposed_b == rhs.transposed_b;
+}
+
+size_t BrgemmTuningDB::Key::hash() const {
+    size_t seed = 0;
+    seed = hash_combine(seed, M);
+    seed = hash_combine(seed, N);
+    seed = hash_combine(seed, K);
+    seed = hash_combine(seed, in0_type.hash());
+    seed = hash_combine(seed, in1_type.hash());
+    seed = hash_combine(seed, static_cast<uint64_t>(isa));
+    seed = hash_combine(seed, with_wei_repacking);
+    seed = hash_combine(seed, transposed_b);
+    return seed;
+}
+
+std::shared_ptr<BrgemmTuningDB> BrgemmTuningDB::get(const std::string& path) {
+    static std::mutex instances_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<BrgemmTuningDB>> instances;
+
+    std::lock_guard<std::mutex> lock(instances_mutex);
+    auto& instance = instances[path];
+    auto db = instance.lock();
+    if (!db) {
+        db = std::make_shared<BrgemmTuningDB>(path);
+        instance = db;
+    }
+    return db;
+}
+
+BrgemmTuningDB::BrgemmTuningDB(std::string path) : m_path(std::move(path)) {
+    load();
+}
+
+void BrgemmTuningDB::load() {
+    std::ifstream file(m_path);
+    if (!file.is_open()) {
+        // DB is created on the first insertion
+        return;
+    }
+    // Record format: M N K in0_type in1_type isa with_wei_repacking transposed_b m_blk n_blk k_blk
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream record(line);
+        Key key;
+        BrgemmBlocking blocking;
+        std::string in0_type;
+        std::string in1_type;
+        uint64_t isa = 0;
+        if (!(record >> key.M >> key.N >> key.K >> in0_type >> in1_type >> isa >> key.with_wei_repacking >>
+              key.transposed_b >> blocking.m_blk >> blocking.n_blk >> blocking.k_blk)) {
+            // Skip corrupted or truncated records
+            continue;
+        }
+        try {
+            key.in0_type = ov::element::Type(in0_type);
+            key.in1_type = ov::element::Type(in1_type);
+        } catch (const ov::Exception&) {
+            continue;
+        }
+        key.isa = static_cast<cpu_isa_t>(isa);
+        m_records[key] = blocking;
+    }
+}
+
+std::optional<BrgemmBlocking> BrgemmTuningDB::find(const Key& key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_records.find(key);
+    if (it == m_records.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void BrgemmTuningDB::insert(const Key& key, const BrgemmBlocking& blocking) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records[key] = blocking;
+    std::ofstream file(m_path, std::ios::app);
+    OPENVINO_ASSERT(file.is_open(), "Cannot open Brgemm tuning DB file: ", m_path);
+    file << key.M << " " << key.N << " " << key.K << " " << key.in0_type.get_type_name() << " "
+         << key.in1_type.get_type_name() << " " << static_cast<uint64_t>(key.isa) << " " << key.with_wei_repacking
+         << " " << key.transposed_b << " " << blocking.m_blk << " " << blocking.n_blk << " " << blocking.k_blk << "\n";
+}
+
+BrgemmBlockingTuner::BrgemmBlockingTuner(std::shared_ptr<BrgemmTuningDB> db) : m_db(std::move(db)) {
+    OPENVINO_ASSERT(m_db, "Brgemm tuning DB is nullptr");
+}
+
+BrgemmBlocking BrgemmBlockingTuner::tune(const BrgemmTuningDB::Key& key,
+                                         const std::vector<BrgemmBlocking>& candidates) {
+    OPENVINO_ASSERT(!candidates.empty(), "Brgemm blocking candidates are empty");
+    // Only one benchmark runs in the process at a time: the timings of concurrent benchmarks are not reliable.
+    // The DB is checked again under the lock, so a signature tuned by another compilation is not benchmarked twice.
+    static std::mutex benchmark_mutex;
+    auto best = m_db->find(key);
+    std::unique_lock<std::mutex> benchmark_lock(benchmark_mutex, std::defer_lock);
+    if (!best) {
+        benchmark_lock.lock();
+        best = m_db->find(key);
+    }
+    if (!best) {
+        best = candidates.front();
+        auto best_time = std::numeric_limits<double>::max();
+        for (const auto& candidate : candidates) {
+            double time = std::numeric_limits<double>::max();
+            try {
+                time = benchmark(key, candidate);
+            } catch (const ov::Exception&) {
+                // The candidate is not supported by brgemm kernel on this ISA
+                continue;
+            }
+            if (time < best_time) {
+                best_time = time;
+                best = candidate;
+            }
+        }
+        m_db->insert(key, *best);
+    }
+
+    std::ostringstream record;
+    record << key.M << "x" << key.N << "x" << key.K << ":" << best->m_blk << "/" << best->n_blk << "/" << best->k_blk;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_report.push_back(record.str());
+    return *best;
+}
+
+std::string BrgemmBlockingTuner::take_report() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::ostringstream report;
+    for (size_t i = 0; i < m_report.size(); ++i) {
+        report << (i == 0 ? "" : ";") << m_report[i];
+    }
+    m_report.clear();
+    return report.str();
+}
+
+double BrgemmBlockingTuner::benchmark(const BrgemmTuningDB::Key& key, const BrgemmBlocking& blocking) {
+    const auto out_type = key.in0_type.is_integral() ? ov::element::i32 : ov::element::f32;
+    const auto in0_size = key.in0_type.size();
+    const auto in1_size = key.in1_type.size();
+    const auto out_size = out_type.size();
+    // Low precision weights are stored in VNNI format: K must be padded to the VNNI factor
+    const auto vnni_factor = std::max<size_t>(4 / in1_size, 1);
+    const auto K_padded = ov::snippets::utils::rnd_up(key.K, vnni_factor);
+
+    // The values don't matter for timing, only the memory footprint does
+    std::vector<uint8_t> src(key.M * key.K * in0_size);
+    std::vector<uint8_t> wei(K_padded * key.N * in1_size);
+    std::vector<uint8_t> dst(key.M * key.N * out_size);
+
+    dnnl_post_ops post_ops;
+    std::map<std::tuple<size_t, size_t, size_t, bool>, std::shared_ptr<brgemm_kernel_t>> kernels;
+    auto get_kernel = [&](size_t m, size_t n, size_t k, bool accumulate) {
+        auto& kernel = kernels[std::make_tuple(m, n, k, accumulate)];
+        if (!kernel) {
+            BrgemmBaseKernelExecutor::create_brgemm_kernel(kernel,
+                                                           DTYPE_CAST(key.in0_type),
+                                                           DTYPE_CAST(key.in1_type),
+                                                           DTYPE_CAST(out_type),
+                                                           key.isa,
+                                                           static_cast<dnnl_dim_t>(m),
+                                                           static_cast<dnnl_dim_t>(n),
+                                                           static_cast<dnnl_dim_t>(k),
+                                                           static_cast<dnnl_dim_t>(key.K),
+                                                           static_cast<dnnl_dim_t>(key.N),
+                                                           static_cast<dnnl_dim_t>(key.N),
+                                                           accumulate ? 1.F : 0.F,
+                                                           post_ops);
+        }
+        return kernel;
+    };
+
+    // The loop order matches the one which is created by BrgemmCPUBlocking: M -> N -> K
+    auto run = [&]() {
+        for (size_t m = 0; m < key.M; m += blocking.m_blk) {
+            const auto m_cnt = std::min(blocking.m_blk, key.M - m);
+            for (size_t n = 0; n < key.N; n += blocking.n_blk) {
+                const auto n_cnt = std::min(blocking.n_blk, key.N - n);
+                for (size_t k = 0; k < key.K; k += blocking.k_blk) {
+                    const auto k_cnt = std::min(blocking.k_blk, key.K - k);
+                    BrgemmBaseKernelExecutor::execute_brgemm_kernel(get_kernel(m_cnt, n_cnt, k_cnt, k != 0),
+                                                                    src.data() + (m * key.K + k) * in0_size,
+                                                                    wei.data() + (k * key.N + n) * in1_size,
+                                                                    dst.data() + (m * key.N + n) * out_size,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    false,
+                                                                    false);
+                }
+            }
+        }
+    };
+
+    // Warm-up run also generates all the kernels
+    run();
+    constexpr size_t iterations = 3;
+    auto best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return best;
+}
+
+#undef DTYPE_CAST
+
+}  // namespace ov::intel_cpu::x64
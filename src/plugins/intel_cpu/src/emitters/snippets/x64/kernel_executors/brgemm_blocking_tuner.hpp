@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "brgemm_base.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::x64 {
+
+/**
+ * @brief Block sizes of Brgemm by M, N and K dimensions
+ */
+struct BrgemmBlocking {
+    size_t m_blk = 0;
+    size_t n_blk = 0;
+    size_t k_blk = 0;
+
+    bool operator==(const BrgemmBlocking& rhs) const {
+        return m_blk == rhs.m_blk && n_blk == rhs.n_blk && k_blk == rhs.k_blk;
+    }
+};
+
+/**
+ * @interface BrgemmTuningDB
+ * @brief Persistent storage of the fastest Brgemm blockings measured for (M, N, K, precisions, ISA, weights layout)
+ *        signatures.
+ *        Records are appended to a text file one per line, so the file can be shared between several compilations.
+ *        If the same signature is met several times in the file, the last record wins.
+ */
+class BrgemmTuningDB {
+public:
+    struct Key {
+        size_t M = 0;
+        size_t N = 0;
+        size_t K = 0;
+        ov::element::Type in0_type;
+        ov::element::Type in1_type;
+        dnnl::impl::cpu::x64::cpu_isa_t isa = dnnl::impl::cpu::x64::isa_undef;
+        bool with_wei_repacking = false;
+        bool transposed_b = false;
+
+        bool operator==(const Key& rhs) const;
+        [[nodiscard]] size_t hash() const;
+    };
+
+    /**
+     * @brief Returns DB instance bound to the file. Instances are shared within the process per file path.
+     */
+    static std::shared_ptr<BrgemmTuningDB> get(const std::string& path);
+
+    [[nodiscard]] std::optional<BrgemmBlocking> find(const Key& key) const;
+    void insert(const Key& key, const BrgemmBlocking& blocking);
+
+    explicit BrgemmTuningDB(std::string path);
+
+private:
+    struct KeyHasher {
+        size_t operator()(const Key& key) const {
+            return key.hash();
+        }
+    };
+
+    void load();
+
+    const std::string m_path;
+    mutable std::mutex m_mutex;
+    std::unordered_map<Key, BrgemmBlocking, KeyHasher> m_records;
+};
+
+/**
+ * @interface BrgemmBlockingTuner
+ * @brief Selects Brgemm blocking by benchmarking brgemm kernels for the candidate blockings on the whole (M, N, K)
+ *        problem. The results are stored in the tuning DB, which is consulted before benchmarking.
+ *        Benchmarks are serialized within the process, so the concurrent compilations (e.g. of several streams)
+ *        don't skew each other's timings, and every signature is benchmarked only once.
+ *        Chosen blockings are recorded to be reported in the execution graph.
+ */
+class BrgemmBlockingTuner {
+public:
+    explicit BrgemmBlockingTuner(std::shared_ptr<BrgemmTuningDB> db);
+
+    /**
+     * @brief Returns the fastest blocking among `candidates`. The first candidate is treated as default one.
+     *        Blocks equal to the corresponding dimension mean that the dimension is not blocked.
+     */
+    BrgemmBlocking tune(const BrgemmTuningDB::Key& key, const std::vector<BrgemmBlocking>& candidates);
+
+    /**
+     * @brief Returns blockings chosen since the previous call in format "MxNxK:m_blk/n_blk/k_blk;..."
+     */
+    std::string take_report();
+
+private:
+    static double benchmark(const BrgemmTuningDB::Key& key, const BrgemmBlocking& blocking);
+
+    std::shared_ptr<BrgemmTuningDB> m_db;
+    mutable std::mutex m_mutex;
+    std::vector<std::string> m_report;
+};
+
+}  // namespace ov::intel_cpu::x64
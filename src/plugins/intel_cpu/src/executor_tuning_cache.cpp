@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "executor_tuning_cache.h"
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+
+namespace ov::intel_cpu {
+
+std::optional<std::string> ExecutorTuningCache::find(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_records.find(key);
+    if (it == m_records.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void ExecutorTuningCache::insert(const std::string& key, const std::string& implementation) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records[key] = implementation;
+}
+
+std::string ExecutorTuningCache::serialize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::ostringstream records;
+    for (const auto& [key, implementation] : m_records) {
+        records << key << '=' << implementation << '|';
+    }
+    return records.str();
+}
+
+void ExecutorTuningCache::deserialize(const std::string& records) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::istringstream stream(records);
+    std::string record;
+    while (std::getline(stream, record, '|')) {
+        const auto separator = record.find('=');
+        if (separator == std::string::npos || separator == 0 || separator + 1 == record.size()) {
+            continue;
+        }
+        m_records[record.substr(0, separator)] = record.substr(separator + 1);
+    }
+}
+
+size_t ExecutorTuningCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records.size();
+}
+
+}  // namespace ov::intel_cpu
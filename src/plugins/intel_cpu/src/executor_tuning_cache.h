@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Executor implementations selected by measurement for (operation, candidates, shape bucket) signatures.
+ * The cache is shared between the streams of a compiled model, so a signature is measured only once
+ * even if the same problem is met by several nodes or streams.
+ * The records are exported with the compiled model and restored on import, so the measurement is not
+ * repeated for the model loaded from the cache.
+ */
+class ExecutorTuningCache {
+public:
+    [[nodiscard]] std::optional<std::string> find(const std::string& key) const;
+    void insert(const std::string& key, const std::string& implementation);
+
+    /**
+     * @brief Returns the records in format "<key>=<implementation>|...", the keys must not contain '=' and '|'
+     * (printable separators keep the string intact when it is stored in the model rt_info)
+     */
+    [[nodiscard]] std::string serialize() const;
+    /**
+     * @brief Restores the records produced by serialize(), malformed records are skipped
+     */
+    void deserialize(const std::string& records);
+
+    [[nodiscard]] size_t size() const;
+
+private:
+    mutable std::mutex m_mutex;
+    // ordered to make the exported blob reproducible
+    std::map<std::string, std::string> m_records;
+};
+
+using ExecutorTuningCachePtr = std::shared_ptr<ExecutorTuningCache>;
+
+}  // namespace ov::intel_cpu
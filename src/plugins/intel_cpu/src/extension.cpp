@@ -37,6 +37,7 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/matrix_nms.hpp"
 #include "openvino/op/max_pool.hpp"
+#include "openvino/op/moe.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/mvn.hpp"
 #include "openvino/op/nms_rotated.hpp"
@@ -71,6 +72,7 @@
 #include "ov_ops/fully_connected_quantized.hpp"
 #include "ov_ops/fully_connected_quantized_legacy.hpp"
 #include "ov_ops/gather_compressed.hpp"
+#include "ov_ops/moe_compressed.hpp"
 #include "ov_ops/multiclass_nms_ie_internal.hpp"
 #include "ov_ops/nms_ie_internal.hpp"
 #include "ov_ops/nms_static_shape_ie.hpp"
@@ -101,6 +103,7 @@
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/vector_buffer.hpp"
 #include "transformations/cpu_opset/common/op/causal_mask_preprocess.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
 #include "transformations/cpu_opset/common/op/leaky_relu.hpp"
 #include "transformations/cpu_opset/common/op/ngram.hpp"
 #include "transformations/cpu_opset/common/op/power_static.hpp"
@@ -191,6 +194,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::intel_cpu::LeakyReluNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::PowerStaticNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::CausalMaskPreprocessNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::ImagePreprocessNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SwishNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SDPAWithTransposeReshape>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::NgramNode>>(),
@@ -203,6 +207,8 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::op::internal::NmsStaticShapeIE<ov::op::v8::MatrixNms>>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::RMS>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::RoPE>>(),
+    std::make_shared<ov::OpExtension<ov::op::internal::MOE>>(),
+    std::make_shared<ov::OpExtension<ov::op::internal::MOECompressed>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::FullyConnected>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::FullyConnectedCompressed>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::FullyConnectedQuantizedLegacy>>(),
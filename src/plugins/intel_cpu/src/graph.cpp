@@ -21,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <new>
+#include <optional>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
@@ -45,6 +46,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_state.h"
 #include "node.h"
+#include "node_telemetry.h"
 #include "nodes/common/cpu_convert.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/convert.h"
@@ -401,6 +403,13 @@ void Graph::Activate() {
 
     CreatePrimitivesAndExecConstants();
 
+    m_telemetryBuffer = m_context->getNodeTelemetryBuffer();
+    if (m_telemetryBuffer) {
+        for (const auto& node : m_executableGraphNodes) {
+            m_telemetryCounters[node.get()] = &m_telemetryBuffer->registerNode(node->getName(), node->typeStr);
+        }
+    }
+
 #ifndef CPU_DEBUG_CAPS
     for (auto& graphNode : graphNodes) {
         graphNode->cleanup();
@@ -1619,6 +1628,12 @@ inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, i
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::ov_op_cpu_exec, node, getConfig());
+    std::optional<NodeTelemetryHelper> telemetry;
+    if (m_telemetryBuffer && m_telemetryBuffer->isSampled()) {
+        if (auto it = m_telemetryCounters.find(node.get()); it != m_telemetryCounters.end()) {
+            telemetry.emplace(*it->second);
+        }
+    }
 
     try {
         ExecuteNode(node, request, numaId);
@@ -1660,6 +1675,11 @@ void Graph::Infer(SyncInferRequest* request) {
 
     m_context->allocateMemory();
 
+    // The body graphs are executed without the request and follow the sampling decision of the outer graph
+    if (m_telemetryBuffer && request) {
+        m_telemetryBuffer->startInference();
+    }
+
     switch (status) {
     case Status::ReadyDynamic:
         InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
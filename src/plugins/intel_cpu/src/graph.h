@@ -20,6 +20,7 @@
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_state.h"
 #include "node.h"
+#include "node_telemetry.h"
 #include "nodes/input.h"
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/profiling_info.hpp"
@@ -374,6 +375,10 @@ private:
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+
+    // sampled per-node telemetry, the buffer of the stream is written only by the stream which executes the graph
+    std::shared_ptr<NodeTelemetry::StreamBuffer> m_telemetryBuffer;
+    std::unordered_map<const Node*, NodeTelemetry::Counters*> m_telemetryCounters;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
@@ -12,7 +12,9 @@
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "executor_tuning_cache.h"
 #include "memory_control.hpp"
+#include "node_telemetry.h"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
@@ -27,11 +29,18 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           SharedMultiCachePtr streamsSnippetsCodeCache,
+                           NodeTelemetryPtr nodeTelemetry,
+                           ExecutorTuningCachePtr executorTuningCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
       m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_streamsSnippetsCodeCache(std::move(streamsSnippetsCodeCache)),
+      m_nodeTelemetry(std::move(nodeTelemetry)),
+      m_nodeTelemetryBuffer(m_nodeTelemetry ? m_nodeTelemetry->createStreamBuffer() : nullptr),
+      m_executorTuningCache(std::move(executorTuningCache)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
@@ -9,10 +9,13 @@
 #include <vector>
 
 #include "cache/multi_cache.h"
+#include "cache/shared_multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "executor_tuning_cache.h"
 #include "memory_control.hpp"
+#include "node_telemetry.h"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "sub_memory_manager.hpp"
@@ -37,7 +40,10 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 SharedMultiCachePtr streamsSnippetsCodeCache = nullptr,
+                 NodeTelemetryPtr nodeTelemetry = nullptr,
+                 ExecutorTuningCachePtr executorTuningCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -55,6 +61,26 @@ public:
         return m_snippetsParamsCache;
     }
 
+    // Snippets code cache shared between the streams of the compiled model, may be nullptr
+    [[nodiscard]] SharedMultiCachePtr getStreamsSnippetsCodeCache() const {
+        return m_streamsSnippetsCodeCache;
+    }
+
+    // Sampled per-node telemetry of the compiled model, nullptr if disabled
+    [[nodiscard]] NodeTelemetryPtr getNodeTelemetry() const {
+        return m_nodeTelemetry;
+    }
+
+    // Telemetry buffer of the stream shared by the graph and its body graphs, nullptr if disabled
+    [[nodiscard]] const std::shared_ptr<NodeTelemetry::StreamBuffer>& getNodeTelemetryBuffer() const {
+        return m_nodeTelemetryBuffer;
+    }
+
+    // Measured executor choices shared between the streams of the compiled model, nullptr if tuning is disabled
+    [[nodiscard]] ExecutorTuningCachePtr getExecutorTuningCache() const {
+        return m_executorTuningCache;
+    }
+
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
         return m_rtScratchPads[m_numaNodeId];
     }
@@ -117,6 +143,10 @@ private:
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
+    SharedMultiCachePtr m_streamsSnippetsCodeCache;
+    NodeTelemetryPtr m_nodeTelemetry;
+    std::shared_ptr<NodeTelemetry::StreamBuffer> m_nodeTelemetryBuffer;
+    ExecutorTuningCachePtr m_executorTuningCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
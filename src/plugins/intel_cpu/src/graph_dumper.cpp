@@ -18,7 +18,9 @@
 #include "cpu_types.h"
 #include "graph.h"
 #include "node.h"
+#include "nodes/reference.h"
 #include "nodes/scaled_attn.h"
+#include "nodes/subgraph.h"
 #include "onednn/dnnl.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -70,6 +72,11 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr& node) {
     // Implementation type name
     serialization_info[ov::exec_model_info::IMPL_TYPE] = node->getPrimitiveDescriptorType();
 
+    // Implementations selected by measurement
+    if (const auto tuningInfo = node->getExecutorTuningInfo(); !tuningInfo.empty()) {
+        serialization_info["executorTuning"] = tuningInfo;
+    }
+
     std::string outputPrecisionsStr;
     if (!node->getChildEdges().empty()) {
         std::vector<std::string> outputPrecisions;
@@ -131,6 +138,23 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr& node) {
             serialization_info["kv_cache_precision"] = sdpa_node->getKVCachePrecision().get_type_name();
         }
     }
+    // operations evaluated by the core reference implementation and whether their execution was split
+    if (node->getType() == Type::Reference) {
+        auto* reference_node = dynamic_cast<ov::intel_cpu::node::Reference*>(node.get());
+        if (reference_node) {
+            serialization_info["referenceFallback"] = reference_node->getFallbackInfo();
+        }
+    }
+    // record Brgemm blockings chosen by the tuner for Subgraph node
+    if (node->getType() == Type::Subgraph) {
+        auto* subgraph_node = dynamic_cast<ov::intel_cpu::node::Subgraph*>(node.get());
+        if (subgraph_node) {
+            const auto brgemm_blocking = subgraph_node->getBrgemmBlockingReport();
+            if (!brgemm_blocking.empty()) {
+                serialization_info["brgemm_blocking"] = brgemm_blocking;
+            }
+        }
+    }
 
     return serialization_info;
 }
@@ -411,6 +435,27 @@ void summary_perf(const Graph& graph) {
             std::cout << ss.str();
         }
     }
+    {
+        // operations without a native implementation, evaluated by the core reference code
+        double fallback_avg = 0;
+        std::stringstream ss;
+        for (const auto& it : perf_by_node) {
+            const auto reference = std::dynamic_pointer_cast<node::Reference>(it.first);
+            if (!reference) {
+                continue;
+            }
+            fallback_avg += it.second;
+            ss << std::setw(10) << std::right << std::fixed << std::setprecision(2) << it.second * 100 / total_avg
+               << " %  " << std::setw(8) << std::right << it.second << "(us) " << reference->getName() << " "
+               << reference->getCoreOpType() << (reference->isSplitExecution() ? " split" : " single-threaded")
+               << '\n';
+        }
+        if (!ss.str().empty()) {
+            std::cout << " reference_fallbacks: " << std::fixed << std::setprecision(2)
+                      << fallback_avg * 100 / total_avg << " % of the average latency" << '\n';
+            std::cout << ss.str();
+        }
+    }
 }
 
 void average_counters(const Graph& graph) {
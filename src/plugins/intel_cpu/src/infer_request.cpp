@@ -315,6 +315,9 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const {
+    // With sub-streams every variable is reported once per sub-stream in the rank order. The KV cache of
+    // the attention split by heads keeps only the heads of the rank, so the states of such a variable have to be
+    // concatenated by the head axis to get the whole cache (see ConcatSDPTensorParallelTest).
     if (m_asyncRequest->m_has_sub_infers) {
         auto requests = m_asyncRequest->getSubInferRequest();
         std::vector<ov::SoPtr<ov::IVariableState>> states;
@@ -80,4 +80,73 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Path to the Brgemm blocking tuning DB file for Snippets.
+ * If set, the blocking params of Brgemms with static shapes are selected by benchmarking a small candidate set, and
+ * the winners are appended to the file to be reused by the next compilations. Empty value disables the tuning.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> snippets_brgemm_tuning_db{"SNIPPETS_BRGEMM_TUNING_DB"};
+
+/**
+ * @brief Enables tokenization of the elementwise part of RoPE on Queries and Keys into MHA Subgraph (x64 only).
+ * Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> snippets_mha_rope_tokenization{
+    "SNIPPETS_MHA_ROPE_TOKENIZATION"};
+
+/**
+ * @brief Sampling rate of the per-node execution telemetry: one of N inferences is profiled.
+ * Zero value (default) disables the telemetry.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> node_telemetry_sampling_rate{
+    "CPU_NODE_TELEMETRY_SAMPLING_RATE"};
+
+/**
+ * @brief Per-node and per-node-type latency statistics collected by the sampled telemetry.
+ * Can be requested from the compiled model at any time, including during inference.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> node_telemetry{"CPU_NODE_TELEMETRY"};
+
+/**
+ * @brief Queueing delay statistics of the inference requests of the compiled model per priority
+ * (see ov::hint::model_priority). One line per priority: "<priority>;<tasks>;<average delay us>;<max delay us>".
+ * The statistics belong to the streams executor of the compiled model, so they also cover the other compiled models
+ * sharing it (e.g. with exclusive async requests). Can be requested at any time, including during inference.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> queueing_statistics{"CPU_QUEUEING_STATISTICS"};
+
+/**
+ * @brief Folds the disjoint constant sub-graphs (e.g. weights of different layers) concurrently in the final constant
+ * folding of the transformation pipeline, see ov::pass::ConcurrentConstantFolding. Requires the constant folding of
+ * all the operations of the model to be thread safe for different nodes. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> concurrent_constant_folding{"CPU_CONCURRENT_CONSTANT_FOLDING"};
+
+/**
+ * @brief Collapses the gate/up/down GatherMatmul blocks of the mixture of experts into a single MOE node (x64 only).
+ * The MOE node computes in f32 regardless of ov::hint::inference_precision, so the GatherMatmul nodes are kept by
+ * default. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> moe_op_fusion{"CPU_MOE_OP_FUSION"};
+
+/**
+ * @brief Enables measured executor selection for FullyConnected, MatMul and Convolution nodes.
+ * If several implementations are eligible for a node, each of them is timed on the first inferences of
+ * a shape bucket and the fastest one is used afterwards. The choices are shared between the streams and
+ * exported to the model cache together with the compiled model.
+ */
+static constexpr Property<bool, PropertyMutability::RW> executor_autotuning{"CPU_EXECUTOR_AUTOTUNING"};
+
+/**
+ * @brief Dispatches the parallel regions of the plugin and oneDNN primitives to a persistent per-stream pool
+ * of spinning workers instead of TBB. Reduces the dispatch overhead of the small regions (e.g. LLM decode).
+ */
+static constexpr Property<bool, PropertyMutability::RW> spin_worker_pool{"CPU_SPIN_WORKER_POOL"};
+
+/**
+ * @brief Time in microseconds the workers of the spinning pool busy wait for the next region before parking.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> spin_worker_pool_spin_time{
+    "CPU_SPIN_WORKER_POOL_SPIN_TIME"};
+
 }  // namespace ov::intel_cpu
@@ -480,6 +480,11 @@ public:
 
     virtual std::string getPrimitiveDescriptorType() const;
 
+    // summary of the measured executor selection reported in the execution graph, empty if not applicable
+    [[nodiscard]] virtual std::string getExecutorTuningInfo() const {
+        return {};
+    }
+
     PerfCount& PerfCounter() {
         return perfCounter;
     }
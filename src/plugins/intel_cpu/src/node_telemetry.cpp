@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_telemetry.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+namespace {
+struct Aggregate {
+    std::string type;
+    uint64_t count = 0;
+    uint64_t totalNs = 0;
+    std::array<uint64_t, NodeTelemetry::bucketsNum> buckets{};
+
+    void merge(const NodeTelemetry::Counters& counters) {
+        count += counters.count.load(std::memory_order_relaxed);
+        totalNs += counters.totalNs.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            buckets[i] += counters.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] double percentileUs(double percentile) const {
+        uint64_t total = 0;
+        for (const auto bucket : buckets) {
+            total += bucket;
+        }
+        const auto target = static_cast<uint64_t>(percentile * static_cast<double>(total));
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            accumulated += buckets[i];
+            if (accumulated > target) {
+                return static_cast<double>(uint64_t{1} << i) / 1000.0;
+            }
+        }
+        return static_cast<double>(uint64_t{1} << (buckets.size() - 1)) / 1000.0;
+    }
+};
+
+void print(std::ostream& os, const char* kind, const std::string& name, const Aggregate& aggregate) {
+    if (aggregate.count == 0) {
+        return;
+    }
+    os << kind << ";" << name << ";" << aggregate.type << ";" << aggregate.count << ";"
+       << static_cast<double>(aggregate.totalNs) / static_cast<double>(aggregate.count) / 1000.0 << ";"
+       << aggregate.percentileUs(0.5) << ";" << aggregate.percentileUs(0.9) << ";" << aggregate.percentileUs(0.99)
+       << "\n";
+}
+}  // namespace
+
+NodeTelemetry::Counters& NodeTelemetry::StreamBuffer::registerNode(const std::string& name, const std::string& type) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_counters.emplace_back(name, type);
+}
+
+std::shared_ptr<NodeTelemetry::StreamBuffer> NodeTelemetry::createStreamBuffer() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_buffers.emplace_back(std::make_shared<StreamBuffer>(m_samplingRate));
+}
+
+std::string NodeTelemetry::getReport() const {
+    // std::map keeps the report ordered by names
+    std::map<std::string, Aggregate> perNode;
+    std::map<std::string, Aggregate> perType;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& buffer : m_buffers) {
+            std::lock_guard<std::mutex> bufferLock(buffer->m_mutex);
+            for (const auto& counters : buffer->m_counters) {
+                auto& node = perNode[counters.name];
+                node.type = counters.type;
+                node.merge(counters);
+                auto& type = perType[counters.type];
+                type.type = counters.type;
+                type.merge(counters);
+            }
+        }
+    }
+
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(3);
+    for (const auto& [name, aggregate] : perNode) {
+        print(report, "node", name, aggregate);
+    }
+    for (const auto& [type, aggregate] : perType) {
+        print(report, "type", type, aggregate);
+    }
+    return report.str();
+}
+
+}  // namespace ov::intel_cpu
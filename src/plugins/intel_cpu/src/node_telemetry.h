@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Low overhead per-node execution telemetry.
+ * Only one of N inferences is profiled (N is a sampling rate). The latencies are accumulated
+ * into log2 histograms which are stored in the per-stream buffers: each buffer has a single writer
+ * (the stream the graph is executed on) so the counters are updated without locks.
+ * The aggregated report can be requested at any time from any thread.
+ */
+class NodeTelemetry {
+public:
+    // Bucket i contains latencies in [2^(i-1), 2^i) nanoseconds, the last one is unbounded
+    static constexpr size_t bucketsNum = 32;
+
+    struct Counters {
+        const std::string name;
+        const std::string type;
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> totalNs{0};
+        std::array<std::atomic<uint64_t>, bucketsNum> buckets{};
+
+        Counters(std::string name, std::string type) : name(std::move(name)), type(std::move(type)) {}
+
+        void add(uint64_t ns) {
+            // relaxed single writer updates: the readers can observe a slightly inconsistent snapshot only
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            totalNs.store(totalNs.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+            auto& bucket = buckets[bucketIdx(ns)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Counters of the nodes executed by one stream. The buffer is shared by the graph of the stream
+     * and its body graphs (e.g. of TensorIterator or If), so a sampled inference is profiled as a whole.
+     */
+    class StreamBuffer {
+    public:
+        explicit StreamBuffer(uint32_t samplingRate) : m_samplingRate(samplingRate) {}
+
+        // Is called during graph activation only, returned reference stays valid for the buffer lifetime
+        Counters& registerNode(const std::string& name, const std::string& type);
+
+        // Is called once per inference by the graph of the stream before its nodes are executed
+        void startInference() {
+            m_sampled = m_inferCount++ % m_samplingRate == 0;
+        }
+
+        [[nodiscard]] bool isSampled() const {
+            return m_sampled;
+        }
+
+    private:
+        friend class NodeTelemetry;
+        const uint32_t m_samplingRate;
+        uint64_t m_inferCount = 0;
+        bool m_sampled = false;
+        std::mutex m_mutex;
+        std::deque<Counters> m_counters;
+    };
+
+    explicit NodeTelemetry(uint32_t samplingRate) : m_samplingRate(samplingRate) {}
+
+    [[nodiscard]] uint32_t getSamplingRate() const {
+        return m_samplingRate;
+    }
+
+    // Is called once per stream
+    std::shared_ptr<StreamBuffer> createStreamBuffer();
+
+    /**
+     * @brief Returns the report aggregated over all the streams. Each line has the format
+     * "<node|type>;<name>;<node type>;<samples>;<avg us>;<p50 us>;<p90 us>;<p99 us>",
+     * where percentiles are upper bounds of the corresponding histogram buckets.
+     * Per node lines are followed by per node type lines.
+     */
+    [[nodiscard]] std::string getReport() const;
+
+    static size_t bucketIdx(uint64_t ns) {
+        size_t idx = 0;
+        while (ns != 0 && idx < bucketsNum - 1) {
+            ns >>= 1;
+            idx++;
+        }
+        return idx;
+    }
+
+private:
+    const uint32_t m_samplingRate;
+    mutable std::mutex m_mutex;
+    std::vector<std::shared_ptr<StreamBuffer>> m_buffers;
+};
+
+using NodeTelemetryPtr = std::shared_ptr<NodeTelemetry>;
+
+class NodeTelemetryHelper {
+    NodeTelemetry::Counters& m_counters;
+    std::chrono::steady_clock::time_point m_start;
+
+public:
+    explicit NodeTelemetryHelper(NodeTelemetry::Counters& counters)
+        : m_counters(counters),
+          m_start(std::chrono::steady_clock::now()) {}
+
+    ~NodeTelemetryHelper() {
+        const auto duration = std::chrono::steady_clock::now() - m_start;
+        m_counters.add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+};
+
+}  // namespace ov::intel_cpu
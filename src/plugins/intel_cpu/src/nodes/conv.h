@@ -52,6 +52,9 @@ public:
     }
 
     bool canBeExecutedInInt8() const override;
+    std::string getExecutorTuningInfo() const override {
+        return m_executor ? m_executor->tuningInfo() : std::string{};
+    }
     size_t getGroupNum() const {
         return groupNum;
     }
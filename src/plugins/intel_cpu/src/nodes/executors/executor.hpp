@@ -17,6 +17,7 @@
 #include "cache/multi_cache.h"
 #include "cpu_memory.h"
 #include "dnnl_scratch_pad.h"
+#include "executor_tuning_cache.h"
 #include "graph_context.h"
 #include "memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
@@ -61,7 +62,8 @@ public:
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
           numNumaNodes(graphContext->getNumNumaNodes()),
-          cpuParallel(graphContext->getCpuParallel()) {
+          cpuParallel(graphContext->getCpuParallel()),
+          executorTuningCache(graphContext->getExecutorTuningCache()) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
         curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
     }
@@ -100,6 +102,11 @@ public:
         return cpuParallel->get_thread_pool();
     }
 
+    // nullptr if the measured executor selection is disabled
+    [[nodiscard]] ExecutorTuningCachePtr getExecutorTuningCache() const {
+        return executorTuningCache;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
@@ -113,6 +120,7 @@ private:
     int numNumaNodes;
     int curNumaNodeId = -1;
     std::shared_ptr<CpuParallel> cpuParallel;
+    ExecutorTuningCachePtr executorTuningCache;
 };
 
 class ExecutorFactoryLegacy {
@@ -151,6 +159,10 @@ public:
         OPENVINO_THROW_NOT_IMPLEMENTED("This version of the 'execute' method is not implemented by executor");
     }
     [[nodiscard]] virtual impl_desc_type implType() const = 0;
+    // summary of the measured implementation selection, empty if the implementation was not measured
+    [[nodiscard]] virtual std::string tuningInfo() const {
+        return {};
+    }
     virtual void moveMemToNumaNode([[maybe_unused]] int numaID) {
         OPENVINO_THROW_NOT_IMPLEMENTED("This version of the 'moveMemToNumaNode' method is not implemented by executor");
     }
@@ -19,6 +19,7 @@
 #include "nodes/executors/implementations.hpp"
 #include "nodes/executors/memory_arguments.hpp"
 #include "nodes/executors/printers.hpp"
+#include "nodes/executors/tuned_executor.hpp"
 #include "nodes/executors/variable_executor.hpp"
 #include "openvino/core/except.hpp"
 #include "utils/debug_capabilities.h"
@@ -79,6 +80,7 @@ public:
      * @brief Creates an Executor instance based on the provided memory arguments.
      *
      * Depending on the number of available implementations, returns:
+     * - TunedExecutor, if the number of implementations is two or more and executor autotuning is enabled
      * - VariableExecutor, if the number of implementations is two or more
      * - Simple Executor, if there is only one available implementation
      *
@@ -92,6 +94,8 @@ public:
      */
     ExecutorPtr make(const MemoryArgs& memory, bool initVariableExecutor = true) {
         std::vector<ExecutorImplementationRef> implementations;
+        const auto tuningCache = m_context->getExecutorTuningCache();
+        const bool tune = tuningCache && isTunable(m_suitableImplementations.front().get().operationType());
 
         auto acceptsConfig = [](const ExecutorImplementationRef& impl, const executor::Config<Attrs>& config) {
             // current config is already considered as the optimal one
@@ -108,9 +112,10 @@ public:
 
             implementations.push_back(impl);
 
-            if (impl.get().shapeAgnostic() &&
+            if (!tune && impl.get().shapeAgnostic() &&
                 impl.get().type() != ExecutorType::Acl) {  // @todo fix acl_eltwise precision mapping)
                 break;  // there is no way an implementation with a lower priority will be chosen
+                        // (unless the implementations are measured)
             }
         }
 
@@ -125,6 +130,15 @@ public:
             return theOnlyImplementation.create(m_attrs, memory, m_context);
         }
 
+        if (tune) {
+            return std::make_shared<TunedExecutor<Attrs>>(memory,
+                                                          m_attrs,
+                                                          m_context,
+                                                          implementations,
+                                                          tuningCache,
+                                                          initVariableExecutor);
+        }
+
         return std::make_shared<VariableExecutor<Attrs>>(memory,
                                                          m_attrs,
                                                          m_context,
@@ -133,6 +147,11 @@ public:
     }
 
 private:
+    static bool isTunable(const OperationType type) {
+        return type == OperationType::FullyConnected || type == OperationType::MatMul ||
+               type == OperationType::Convolution;
+    }
+
     /**
      * @brief Filters and retrieves suitable implementations based on the provided executor configuration.
      *
@@ -95,6 +95,7 @@ SubgraphBaseExecutor::SubgraphBaseExecutor(const std::shared_ptr<CPURuntimeConfi
                                            [[maybe_unused]] const BufferScratchpadAllocator& allocator,
                                            [[maybe_unused]] const ov::intel_cpu::MultiCacheWeakPtr& kernel_cache)
     : m_schedule(snippet->get()),
+      m_brgemm_blocking_report(snippet->get_brgemm_blocking_report()),
       m_start_offset_in(std::move(start_offset_in)),
       m_start_offset_out(std::move(start_offset_out)) {
     OPENVINO_ASSERT(m_schedule, "Schedule is empty!");
@@ -10,6 +10,8 @@
 #include <functional>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "cache/multi_cache.h"
@@ -45,8 +47,17 @@ public:
         return schedule;
     }
 
+    // Brgemm blockings chosen by the tuner during the code generation, kept together with the (possibly shared) code
+    void set_brgemm_blocking_report(std::string report) {
+        brgemm_blocking_report = std::move(report);
+    }
+    [[nodiscard]] const std::string& get_brgemm_blocking_report() const {
+        return brgemm_blocking_report;
+    }
+
 private:
     std::shared_ptr<snippets::Schedule> schedule;
+    std::string brgemm_blocking_report;
 };
 
 class SubgraphBaseExecutor {
@@ -74,6 +85,10 @@ public:
     static void init_parallel_domain(const std::shared_ptr<CPURuntimeConfig>& snippet_config,
                                      std::vector<size_t>& domain);
 
+    [[nodiscard]] const std::string& get_brgemm_blocking_report() const {
+        return m_brgemm_blocking_report;
+    }
+
 protected:
     virtual void exec_impl(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) = 0;
 
@@ -90,6 +105,7 @@ protected:
     }
 
     std::shared_ptr<snippets::Schedule> m_schedule;
+    std::string m_brgemm_blocking_report;
     // Holds index of output used as in execution domain
     // it should be compatible with a schedule's work size
     std::vector<size_t> m_parallel_exec_domain;
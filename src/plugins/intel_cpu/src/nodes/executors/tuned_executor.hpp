@@ -0,0 +1,304 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "executor.hpp"
+#include "executor_implementation.hpp"
+#include "executor_tuning_cache.h"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * A measuring (tuned) executor
+ * Selects between the executors of all the implementations eligible for the provided memory.
+ * On the first executions with a new shape bucket every implementation which accepts the shapes is timed
+ * and the fastest one is used afterwards. The candidates are created and measured one at a time,
+ * so the trial never keeps more than one set of prepacked weights.
+ * The choice is stored in the tuning cache shared between the streams of the compiled model, so a bucket
+ * measured once (by another node, stream or before the model was exported) is not measured again.
+ */
+template <typename Attrs>
+class TunedExecutor : public Executor {
+public:
+    using ExecutorImplementationRef = std::reference_wrapper<const ExecutorImplementation<Attrs>>;
+
+    TunedExecutor(const MemoryArgs& memory,
+                  Attrs attrs,
+                  ExecutorContext::CPtr context,
+                  std::vector<ExecutorImplementationRef> suitableImplementations,
+                  ExecutorTuningCachePtr tuningCache,
+                  bool init)
+        : m_attrs(std::move(attrs)),
+          m_context(std::move(context)),
+          m_suitableImplementations(std::move(suitableImplementations)),
+          m_tuningCache(std::move(tuningCache)),
+          m_executors(m_suitableImplementations.size()) {
+        OPENVINO_ASSERT(m_tuningCache, "Executor tuning cache is nullptr");
+        if (init) {
+            const auto implementation =
+                std::find_if(m_suitableImplementations.begin(),
+                             m_suitableImplementations.end(),
+                             [&memory, this](const ExecutorImplementationRef& impl) {
+                                 return impl.get().acceptsShapes(m_attrs, memory);
+                             });
+            OPENVINO_ASSERT(implementation != m_suitableImplementations.end(), "Failed to select an implemetation");
+            m_implId = std::distance(m_suitableImplementations.begin(), implementation);
+            m_executors[m_implId] = create(m_implId, memory);
+        }
+    }
+
+    bool update(const MemoryArgs& memory) override {
+        auto key = makeKey(memory);
+
+        // the shapes of the same bucket continue the trial in progress
+        if (m_trial && key == m_key) {
+            if (prepare(m_implId, memory)) {
+                return true;
+            }
+            return nextCandidate(memory) || selectBest(memory);
+        }
+
+        m_trial.reset();
+        m_key = std::move(key);
+
+        std::vector<size_t> candidates;
+        for (size_t implId = 0; implId < m_suitableImplementations.size(); implId++) {
+            if (m_suitableImplementations[implId].get().acceptsShapes(m_attrs, memory)) {
+                candidates.push_back(implId);
+            }
+        }
+
+        if (const auto chosen = m_tuningCache->find(m_key)) {
+            for (const auto implId : candidates) {
+                if (*chosen == m_suitableImplementations[implId].get().name() && activate(implId, memory)) {
+                    m_info = *chosen + " (cached)";
+                    return true;
+                }
+            }
+        }
+
+        if (candidates.empty()) {
+            return false;
+        }
+        if (candidates.size() == 1) {
+            if (!activate(candidates.front(), memory)) {
+                return false;
+            }
+            m_info = m_suitableImplementations[m_implId].get().name();
+            return true;
+        }
+
+        Trial trial;
+        trial.candidates = std::move(candidates);
+        trial.bestNs.assign(trial.candidates.size(), std::numeric_limits<uint64_t>::max());
+        // the trial starts before the first candidate, nextCandidate() wraps the index around to zero
+        trial.current = std::numeric_limits<size_t>::max();
+        m_trial = std::move(trial);
+        m_info.clear();
+        if (!nextCandidate(memory)) {
+            m_trial.reset();
+            return false;
+        }
+        return true;
+    }
+
+    void execute(const MemoryArgs& memory) override {
+        if (!m_trial) {
+            m_executors[m_implId]->execute(memory);
+            return;
+        }
+
+        auto& trial = *m_trial;
+        const auto start = std::chrono::steady_clock::now();
+        m_executors[m_implId]->execute(memory);
+        const auto ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+        // the first runs warm up caches and lazily initialized resources, the best of the others is taken
+        if (trial.run++ >= warmupRuns) {
+            trial.bestNs[trial.current] = std::min(trial.bestNs[trial.current], ns);
+        }
+        if (trial.run < warmupRuns + measuredRuns) {
+            return;
+        }
+
+        if (!nextCandidate(memory)) {
+            OPENVINO_ASSERT(selectBest(memory), "Failed to select the measured executor implementation");
+        }
+    }
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return m_executors[m_implId]->implType();
+    }
+
+    [[nodiscard]] std::string tuningInfo() const override {
+        return m_info;
+    }
+
+    void moveMemToNumaNode(int numaID) override {
+        for (const auto& executor : m_executors) {
+            if (executor) {
+                executor->moveMemToNumaNode(numaID);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t warmupRuns = 1;
+    static constexpr size_t measuredRuns = 3;
+
+    struct Trial {
+        std::vector<size_t> candidates;
+        std::vector<uint64_t> bestNs;
+        size_t current = 0;
+        size_t run = 0;
+    };
+
+    // Leading dimensions of the activations are rounded up to a power of two,
+    // so the dynamic shapes of the same order share the measurement
+    static size_t bucket(size_t dim) {
+        size_t rounded = 1;
+        while (rounded < dim) {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+
+    [[nodiscard]] std::string makeKey(const MemoryArgs& memory) const {
+        std::ostringstream key;
+        key << static_cast<int>(m_suitableImplementations.front().get().operationType()) << ';';
+        for (const auto& impl : m_suitableImplementations) {
+            key << impl.get().name() << ',';
+        }
+        // ordered by argument id to keep the key stable
+        const std::map<int, MemoryPtr> arguments(memory.begin(), memory.end());
+        for (const auto& [argId, mem] : arguments) {
+            if (!mem || !mem->getDesc().isDefined()) {
+                continue;
+            }
+            key << ';' << argId << ':' << mem->getDesc().getPrecision().get_type_name() << ':';
+            const bool activations = argId == ARG_SRC || argId == ARG_DST;
+            for (const auto dim : mem->getStaticDims()) {
+                key << (activations ? bucket(dim) : dim) << 'x';
+            }
+        }
+        return key.str();
+    }
+
+    bool prepare(const size_t implId, const MemoryArgs& memory) {
+        if (!m_executors[implId]) {
+            m_executors[implId] = create(implId, memory);
+            if (!m_executors[implId]) {
+                return false;
+            }
+        }
+        return m_executors[implId]->update(memory);
+    }
+
+    // makes the implementation current, the other executors are released to free their prepacked weights
+    bool activate(const size_t implId, const MemoryArgs& memory) {
+        if (!prepare(implId, memory)) {
+            m_executors[implId] = nullptr;
+            return false;
+        }
+        for (size_t i = 0; i < m_executors.size(); i++) {
+            if (i != implId) {
+                m_executors[i] = nullptr;
+            }
+        }
+        m_implId = implId;
+        return true;
+    }
+
+    // switches the trial to the next candidate which can be prepared, false if there is none left
+    bool nextCandidate(const MemoryArgs& memory) {
+        auto& trial = *m_trial;
+        trial.run = 0;
+        for (trial.current++; trial.current < trial.candidates.size(); trial.current++) {
+            // the measured executor is released before the next one is created
+            std::fill(m_executors.begin(), m_executors.end(), nullptr);
+            if (activate(trial.candidates[trial.current], memory)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // finishes the trial with the fastest of the measured candidates
+    bool selectBest(const MemoryArgs& memory) {
+        const auto trial = std::move(*m_trial);
+        m_trial.reset();
+
+        const auto best =
+            std::distance(trial.bestNs.begin(), std::min_element(trial.bestNs.begin(), trial.bestNs.end()));
+        if (trial.bestNs[best] == std::numeric_limits<uint64_t>::max()) {
+            return false;
+        }
+        // the best one is recreated unless it was measured the last
+        if (trial.candidates[best] != m_implId) {
+            std::fill(m_executors.begin(), m_executors.end(), nullptr);
+        }
+        if (!activate(trial.candidates[best], memory)) {
+            return false;
+        }
+        const std::string chosen = m_suitableImplementations[m_implId].get().name();
+        m_tuningCache->insert(m_key, chosen);
+
+        std::ostringstream info;
+        info << chosen << " (" << std::fixed << std::setprecision(3);
+        bool first = true;
+        for (size_t i = 0; i < trial.candidates.size(); i++) {
+            if (trial.bestNs[i] == std::numeric_limits<uint64_t>::max()) {
+                continue;  // could not be prepared
+            }
+            info << (first ? "" : ", ") << m_suitableImplementations[trial.candidates[i]].get().name() << ' '
+                 << static_cast<double>(trial.bestNs[i]) / 1e6 << " ms";
+            first = false;
+        }
+        info << ')';
+        m_info = info.str();
+        DEBUG_LOG("Executor tuning: ", m_key, " -> ", m_info);
+        return true;
+    }
+
+    ExecutorPtr create(const size_t implId, const MemoryArgs& memory) {
+        assert(implId < m_executors.size() && implId < m_suitableImplementations.size());
+
+        const auto& impl = m_suitableImplementations[implId].get();
+        return impl.create(m_attrs, memory, m_context);
+    }
+
+    Attrs m_attrs;
+    const ExecutorContext::CPtr m_context;
+    std::vector<ExecutorImplementationRef> m_suitableImplementations;
+    ExecutorTuningCachePtr m_tuningCache;
+    // executors cache
+    std::vector<ExecutorPtr> m_executors;
+    size_t m_implId = 0;
+    std::string m_key;
+    std::optional<Trial> m_trial;
+    std::string m_info;
+};
+
+}  // namespace ov::intel_cpu
@@ -9,7 +9,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <unordered_map>
@@ -17,7 +16,7 @@
 #include <vector>
 
 #include "common/cpu_convert.h"
-#include "common/cpu_memcpy.h"
+#include "collectives.hpp"
 #include "config.h"
 #include "cpu_memory.h"
 #include "cpu_types.h"
@@ -42,7 +41,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
-#include "openvino/runtime/threading/cpu_message.hpp"
 #include "ov_ops/fully_connected.hpp"
 #include "ov_ops/fully_connected_compressed.hpp"
 #include "ov_ops/fully_connected_quantized.hpp"
@@ -216,22 +214,10 @@ bool FullyConnected::isSupportedCompressedOperation([[maybe_unused]] const std::
 #endif
 }
 
-void FullyConnected::initTensorParallelConfig(const GraphContext::CPtr& context) {
-    if (context->getCPUStreamExecutor()) {
-        if (!context->getCPUStreamExecutor()->get_rank().empty()) {
-            // init tp_cfg.w_rank and tp_cfg.w_size
-            tp_cfg.w_rank = context->getCPUStreamExecutor()->get_rank()[0];
-            tp_cfg.w_size = ov::threading::message_manager()->get_num_sub_streams();
-            tp_cfg.enable_tensor_parallel = tp_cfg.w_size > 1;
-            tp_cfg.sub_memory = context->getSubMemory();
-        }
-    }
-}
-
 FullyConnected::FullyConnected(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
     : Node(op, context, FCShapeInferFactory(op)) {
     std::string errorMessage;
-    initTensorParallelConfig(context);
+    tp_cfg = FCTensorParallelConfig(initTensorParallelConfig(context));
     if (!isSupportedOperation(op, errorMessage)) {
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
     }
@@ -314,112 +300,28 @@ void FullyConnected::prepareParams() {
 
 void FullyConnected::initTensorParallelSync() {
     if (tp_cfg.enable_tensor_parallel) {
-        tp_cfg.id = tp_cfg.sub_memory->get_memory_id(tp_cfg.w_rank);
-        CPU_NODE_ASSERT(tp_cfg.id >= 0, "Tensor Parallel Config ID cannot be negative.");
-        tp_cfg.sub_memory->set_memory_used(tp_cfg.id, tp_cfg.w_rank);
-        while (true) {
-            std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
-            if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == tp_cfg.w_size) {
-                tp_cfg.sub_memory->_use_count[tp_cfg.id] = 0;
-                for (int i = 0; i < tp_cfg.w_size; i++) {
-                    tp_cfg.sub_memory->_memorys_table[tp_cfg.id][i].flag = false;
-                }
-            }
-            if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == 0) {
-                break;
-            }
-        }
+        // the other ranks may still gather the result of the previous execution from cached_dst
+        tp_cfg.communicator->wait_released(tp_cfg.w_rank);
     }
 }
 
 void FullyConnected::execTensorParallelSync() {
     if (tp_cfg.enable_tensor_parallel) {
-        const auto& cpu_parallel = context->getCpuParallel();
-        // dst
         auto dst = getDstMemoryAtPort(0);
-        auto* dst_ptr = static_cast<uint8_t*>(dst->getData());
-
-        const auto& shape = dst->getShape();
-        auto dims = shape.getDims();
-        auto prec = dst->getPrecision();
-
-        // cur dst
-        auto cur_dst = memory[ARG_DST];
-
-        auto split_parts = [](int len, int n) {
-            int average = len / n;
-            std::vector<int> parts(n, average);
-            parts.back() = len - average * (n - 1);
-            return parts;
-        };
-
-        const int dim = dims.size() - 1;
-        // selected dim bytes
-        auto channel_size = dims[dim] * prec.size();
-        // total bytes
-        auto mem_size = dst->getSize();
-        // the steps need to copy.
-        const size_t count = (mem_size / channel_size);
-
-        auto splited_dim_vec = split_parts(dims[dim], tp_cfg.w_size);
-        const auto strideSize = splited_dim_vec[0] * prec.size();
-
-        tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].send_buf = cur_dst->getData();
-        tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].flag = true;
-
-        std::vector<int> wait_list(tp_cfg.w_size, 1);
-        while (true) {
-            int wait_size = 0;
-            for (int idx = 0; idx < tp_cfg.w_size; idx++) {
-                if (wait_list[idx] > 0 && tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].flag) {
-                    auto* new_ptr = static_cast<uint8_t*>(tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].send_buf);
-                    const auto copySize = splited_dim_vec[idx] * prec.size();  // bytes of half selected dim.
-                    const size_t unloop = 8;
-                    size_t step = count / unloop;
-                    cpu_parallel->parallel_for(step, [&](size_t i) {
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop) * channel_size,
-                                   new_ptr + (i * unloop) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 1) * channel_size,
-                                   new_ptr + (i * unloop + 1) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 2) * channel_size,
-                                   new_ptr + (i * unloop + 2) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 3) * channel_size,
-                                   new_ptr + (i * unloop + 3) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 4) * channel_size,
-                                   new_ptr + (i * unloop + 4) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 5) * channel_size,
-                                   new_ptr + (i * unloop + 5) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 6) * channel_size,
-                                   new_ptr + (i * unloop + 6) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 7) * channel_size,
-                                   new_ptr + (i * unloop + 7) * copySize,
-                                   copySize);
-                    });
-                    size_t tail = count & ~(unloop - 1);
-                    for (size_t i = tail; i < count; ++i) {
-                        size_t dst_offset = i * channel_size + idx * strideSize;
-                        size_t src_offset = i * copySize;
-                        cpu_parallel_memcpy(dst_ptr + dst_offset, new_ptr + src_offset, copySize);
-                    }
-                    wait_list[idx] = 0;
-                }
-                wait_size += wait_list[idx];
-            }
-            if (wait_size == 0) {
-                break;
-            }
-        }
-        {
-            std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
-            tp_cfg.sub_memory->_use_count[tp_cfg.id]++;
-        }
+        const auto& dims = dst->getShape().getDims();
+        const auto prec_size = dst->getPrecision().size();
+        // bytes of the whole row of the output
+        const auto row_size = dims.back() * prec_size;
+        const auto rows = dst->getSize() / row_size;
+        // the output of the rank is split by the last dimension in the same way as cached_dst
+        const auto part_row_size = tp_cfg.communicator->get_part(tp_cfg.w_rank, dims.back()).second * prec_size;
+
+        tp_cfg.communicator->all_gather(tp_cfg.w_rank,
+                                        memory[ARG_DST]->getData(),
+                                        part_row_size,
+                                        dst->getData(),
+                                        rows,
+                                        *context->getCpuParallel());
     }
 }
 
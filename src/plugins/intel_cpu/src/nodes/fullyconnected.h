@@ -12,8 +12,10 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "collectives.hpp"
 #include "config.h"
 #include "cpu_memory.h"
 #include "graph_context.h"
@@ -24,17 +26,14 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
-#include "sub_memory_manager.hpp"
 
 namespace ov::intel_cpu::node {
 
 // tensor parallel config
-struct FCTensorParallelConfig {
-    int w_rank = -1;
-    int w_size = -1;
-    int id = 0;
-    bool enable_tensor_parallel = false;
-    std::shared_ptr<SubMemoryManager> sub_memory = nullptr;
+struct FCTensorParallelConfig : public TensorParallelConfig {
+    FCTensorParallelConfig() = default;
+    explicit FCTensorParallelConfig(TensorParallelConfig config) : TensorParallelConfig(std::move(config)) {}
+
     MemoryPtr cached_splited_weight = nullptr;
     MemoryPtr cached_splited_bias = nullptr;
     MemoryPtr cached_scale = nullptr;
@@ -84,6 +83,10 @@ public:
         return !isInputTensorAtPortEmpty(0);
     }
 
+    std::string getExecutorTuningInfo() const override {
+        return executor ? executor->tuningInfo() : std::string{};
+    }
+
     void prepareParams() override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
     bool canBeExecutedInInt8() const override;
@@ -113,7 +116,6 @@ private:
 
     void fuseDecompressionConstant(const MemoryCPtr& memory, MemoryCPtr& decompressionValuesPtr);
 
-    void initTensorParallelConfig(const GraphContext::CPtr& context);
     void needUpdateTensorParalelConfig();
     void needPrepareParamsForTensorParallel();
     void initTensorParallelSync();
@@ -0,0 +1,227 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov::intel_cpu::node {
+
+/*
+ImagePreprocess computes in a single pass over the output what the original chain did with
+one intermediate tensor per operation:
+
+    NV12 -> RGB/BGR -> Convert(f32) -> Interpolate(linear, half_pixel) -> (x - mean) * scale -> [NHWC->NCHW]
+
+Each output pixel converts only the (up to) four source pixels it is interpolated from, so for the
+typical downscaling case the full-resolution RGB image is never materialized.
+The color conversion and interpolation formulas match the ColorConvert and Interpolate (linear_onnx) nodes.
+*/
+namespace {
+
+template <bool Round>
+inline std::array<float, 3> yuv_to_rgb(float y, float u, float v) {
+    auto c = y - 16.F;
+    auto d = u - 128.F;
+    auto e = v - 128.F;
+    auto clip = [](float a) -> float {
+        if constexpr (Round) {
+            return std::min(std::max(std::round(a), 0.F), 255.F);
+        }
+        return std::min(std::max(a, 0.F), 255.F);
+    };
+    return {clip(1.164F * c + 1.596F * e), clip(1.164F * c - 0.391F * d - 0.813F * e), clip(1.164F * c + 2.018F * d)};
+}
+
+}  // namespace
+
+ImagePreprocess::ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto node = ov::as_type_ptr<const intel_cpu::ImagePreprocessNode>(op);
+    m_config = node->get_config();
+}
+
+bool ImagePreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                           std::string& errorMessage) noexcept {
+    try {
+        const auto node = ov::as_type_ptr<const intel_cpu::ImagePreprocessNode>(op);
+        if (!node) {
+            errorMessage = "Only ImagePreprocessNode operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+void ImagePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs;
+    for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::u8, getInputShapeAtPort(i), false, -1);
+    }
+
+    std::vector<PortConfigurator> outPortConfigs;
+    outPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getOutputShapeAtPort(0), false, -1);
+
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
+}
+
+ImagePreprocess::LinearTable ImagePreprocess::buildLinearTable(size_t inSize, size_t outSize) {
+    // same as Interpolate::InterpolateExecutorBase::linearOnnxCF for half_pixel with SIZES shape calculation
+    const auto scale = static_cast<float>(outSize) / static_cast<float>(inSize);
+    const auto inLast = static_cast<int>(inSize) - 1;
+    LinearTable table;
+    table.index0.resize(outSize);
+    table.index1.resize(outSize);
+    table.weight0.resize(outSize);
+    table.weight1.resize(outSize);
+    for (size_t o = 0; o < outSize; o++) {
+        float inCoord = static_cast<float>(o);
+        if (scale != 1.F && inSize != outSize) {
+            inCoord = (static_cast<float>(o) + 0.5F) / scale - 0.5F;
+        }
+        inCoord = std::max(0.F, std::min(inCoord, static_cast<float>(inLast)));
+        const int index0 = std::min(static_cast<int>(inCoord), inLast);
+        const int index1 = std::min(index0 + 1, inLast);
+        table.index0[o] = static_cast<size_t>(index0);
+        table.index1[o] = static_cast<size_t>(index1);
+        table.weight1[o] = std::fabs(inCoord - static_cast<float>(index0));
+        table.weight0[o] = std::fabs(inCoord - static_cast<float>(index1));
+        if (index0 == index1) {
+            table.weight0[o] = 0.5F;
+            table.weight1[o] = 0.5F;
+        }
+    }
+    return table;
+}
+
+void ImagePreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    m_srcHeight = m_config.single_plane ? srcDims[1] * 2 / 3 : srcDims[1];
+    m_srcWidth = srcDims[2];
+    m_rows = buildLinearTable(m_srcHeight, static_cast<size_t>(m_config.output_height));
+    m_cols = buildLinearTable(m_srcWidth, static_cast<size_t>(m_config.output_width));
+}
+
+template <bool Round>
+void ImagePreprocess::executeImpl(const uint8_t* y,
+                                  const uint8_t* uv,
+                                  float* dst,
+                                  size_t batch,
+                                  size_t strideY,
+                                  size_t strideUV) {
+    const auto width = m_srcWidth;
+    const auto outHeight = static_cast<size_t>(m_config.output_height);
+    const auto outWidth = static_cast<size_t>(m_config.output_width);
+    const bool resize = outHeight != m_srcHeight || outWidth != m_srcWidth;
+    const bool planar = m_config.planar_output;
+    // BGR output swaps the first and the last channels
+    const size_t c0 = m_config.bgr ? 2 : 0;
+    const size_t c2 = 2 - c0;
+    const auto& mean = m_config.mean;
+    const auto& scale = m_config.scale;
+
+    context->getCpuParallel()->parallel_for2d(batch, outHeight, [&](size_t n, size_t oy) {
+        const uint8_t* yPlane = y + n * strideY;
+        const uint8_t* uvPlane = uv + n * strideUV;
+        auto pixel = [&](size_t iy, size_t ix) {
+            const auto uvIndex = (iy / 2) * width + (ix / 2) * 2;
+            return yuv_to_rgb<Round>(static_cast<float>(yPlane[iy * width + ix]),
+                                     static_cast<float>(uvPlane[uvIndex]),
+                                     static_cast<float>(uvPlane[uvIndex + 1]));
+        };
+        auto store = [&](size_t ox, const std::array<float, 3>& rgb) {
+            const std::array<float, 3> values{rgb[c0], rgb[1], rgb[c2]};
+            if (planar) {
+                float* out = dst + n * 3 * outHeight * outWidth + oy * outWidth + ox;
+                for (size_t c = 0; c < 3; c++) {
+                    out[c * outHeight * outWidth] = (values[c] - mean[c]) * scale[c];
+                }
+            } else {
+                float* out = dst + ((n * outHeight + oy) * outWidth + ox) * 3;
+                for (size_t c = 0; c < 3; c++) {
+                    out[c] = (values[c] - mean[c]) * scale[c];
+                }
+            }
+        };
+
+        if (!resize) {
+            for (size_t ox = 0; ox < outWidth; ox++) {
+                store(ox, pixel(oy, ox));
+            }
+            return;
+        }
+
+        const auto iyT = m_rows.index0[oy];
+        const auto iyB = m_rows.index1[oy];
+        const auto wT = m_rows.weight0[oy];
+        const auto wB = m_rows.weight1[oy];
+        for (size_t ox = 0; ox < outWidth; ox++) {
+            const auto ixL = m_cols.index0[ox];
+            const auto ixR = m_cols.index1[ox];
+            const auto wL = m_cols.weight0[ox];
+            const auto wR = m_cols.weight1[ox];
+            const auto tl = pixel(iyT, ixL);
+            const auto tr = pixel(iyT, ixR);
+            const auto bl = pixel(iyB, ixL);
+            const auto br = pixel(iyB, ixR);
+            std::array<float, 3> rgb{};
+            for (size_t c = 0; c < 3; c++) {
+                rgb[c] = (tl[c] * wL + tr[c] * wR) * wT + (bl[c] * wL + br[c] * wR) * wB;
+            }
+            store(ox, rgb);
+        }
+    });
+}
+
+void ImagePreprocess::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto batch = srcDims[0];
+    const auto planeSize = m_srcHeight * m_srcWidth;
+
+    const auto* y = getSrcDataAtPortAs<const uint8_t>(0);
+    const uint8_t* uv = m_config.single_plane ? y + planeSize : getSrcDataAtPortAs<const uint8_t>(1);
+    const size_t strideY = m_config.single_plane ? planeSize * 3 / 2 : planeSize;
+    const size_t strideUV = m_config.single_plane ? planeSize * 3 / 2 : planeSize / 2;
+    auto* dst = getDstDataAtPortAs<float>(0);
+
+    if (m_config.round_color) {
+        executeImpl<true>(y, uv, dst, batch, strideY, strideUV);
+    } else {
+        executeImpl<false>(y, uv, dst, batch, strideY, strideUV);
+    }
+}
+
+}  // namespace ov::intel_cpu::node
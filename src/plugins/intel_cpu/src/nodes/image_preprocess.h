@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov::intel_cpu::node {
+
+class ImagePreprocess : public Node {
+public:
+    ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    bool created() const override {
+        return getType() == Type::ImagePreprocess;
+    }
+    void prepareParams() override;
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // source indices and weights of the linear_onnx (half_pixel) interpolation along one axis
+    struct LinearTable {
+        std::vector<size_t> index0;
+        std::vector<size_t> index1;
+        std::vector<float> weight0;
+        std::vector<float> weight1;
+    };
+    static LinearTable buildLinearTable(size_t inSize, size_t outSize);
+
+    template <bool Round>
+    void executeImpl(const uint8_t* y, const uint8_t* uv, float* dst, size_t batch, size_t strideY, size_t strideUV);
+
+    intel_cpu::ImagePreprocessNode::Config m_config;
+    LinearTable m_rows;
+    LinearTable m_cols;
+    size_t m_srcHeight = 0;
+    size_t m_srcWidth = 0;
+};
+
+}  // namespace ov::intel_cpu::node
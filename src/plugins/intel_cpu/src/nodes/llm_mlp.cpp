@@ -32,10 +32,12 @@
 #    include <algorithm>
 #    include <atomic>
 #    include <cstddef>
+#    include <tuple>
 #    include <type_traits>
 #    include <utility>
 
 #    include "cpu_memory.h"
+#    include "cpu_parallel.hpp"
 #    include "memory_desc/blocked_memory_desc.h"
 #    include "memory_desc/cpu_blocked_memory_desc.h"
 #    include "openvino/core/parallel.hpp"
@@ -54,6 +56,10 @@ namespace ov::intel_cpu::node {
 
 #if defined(OPENVINO_ARCH_X86_64)
 
+// intermediate size is split between the ranks by the blocks which are multiple of
+// the N blocking of Gate & Up and the K blocking of Down (both for f16 and i8 weights)
+static constexpr size_t tp_block_size = REG_BLK_K_SIZE_I8;
+
 template <typename T>
 class LinearKsplit2 {
 public:
@@ -363,6 +369,9 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
 
     bool m_rt_prec_f16;
 
+    // tensor parallel: partial output of the rank, it is read by the other ranks during all-reduce
+    std::vector<T> m_tp_dst;
+
     // [M, K] x [N, K] => [M, N] x [K, N] => [M, K]
     // w_gate/w_up : [N, K]
     //     w_down  : [K, N]
@@ -379,28 +388,52 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
         auto K = w_gate.size(1);
         auto N = w_gate.size(0);
         OPENVINO_ASSERT(w_gate.stride_bytes(0) == w_up.stride_bytes(0));
-        if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
+        const bool combined = m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE;
+        if (combined) {
             N = w_gate.size(0) / 2;
+        }
+        // tensor parallel: the rank computes [n0, n0 + N) columns of Gate & Up and the same rows of Down
+        const auto full_N = N;
+        size_t n0 = 0;
+        const auto& tp_cfg = pnode->m_tp_cfg;
+        if (tp_cfg.enable_tensor_parallel) {
+            std::tie(n0, N) = tp_cfg.communicator->get_part(tp_cfg.w_rank, full_N / tp_block_size);
+            n0 *= tp_block_size;
+            N *= tp_block_size;
+        }
+        if (combined) {
             if (m_config.gate_up_type == LLMMLPNode::GATE_UP_TYPE::COMBINED_UP_GATE) {
                 // COMBINED_UP_GATE: VariadicSplit output[0] connects to up, output[1] connects to gate
-                gate_up.setup(w_gate.ptr_v(N, 0), w_gate.ptr_v(), w_gate.stride_bytes(0), N * 2, K, config);
+                gate_up.setup(w_gate.ptr_v(full_N + n0, 0),
+                              w_gate.ptr_v(n0, 0),
+                              w_gate.stride_bytes(0),
+                              N * 2,
+                              K,
+                              config);
             } else {
                 // COMBINED_GATE_UP: VariadicSplit output[0] connects to gate, output[1] connects to up
-                gate_up.setup(w_gate.ptr_v(), w_gate.ptr_v(N, 0), w_gate.stride_bytes(0), N * 2, K, config);
+                gate_up.setup(w_gate.ptr_v(n0, 0),
+                              w_gate.ptr_v(full_N + n0, 0),
+                              w_gate.stride_bytes(0),
+                              N * 2,
+                              K,
+                              config);
             }
         } else {
-            gate_up.setup(w_gate.ptr_v(), w_up.ptr_v(), w_up.stride_bytes(0), N * 2, K, config);
+            gate_up.setup(w_gate.ptr_v(n0, 0), w_up.ptr_v(n0, 0), w_up.stride_bytes(0), N * 2, K, config);
         }
-        down.setup(w_down.ptr_v(), w_down.stride_bytes(0), K, N, config);
+        down.setup(w_down.ptr_v(0, n0), w_down.stride_bytes(0), K, N, config);
 
         if (m_config.gate_up_quantized) {
             m_w_scale_gateup.resize<float>({N * 2});
             auto* w_scale_gate = pnode->getSrcMemoryAtPort(4)->getDataAs<float>();
             auto* w_scale_up = pnode->getSrcMemoryAtPort(5)->getDataAs<float>();
             auto* dst = m_w_scale_gateup.ptr<float>();
-            if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
-                w_scale_up = w_scale_gate + N;
+            if (combined) {
+                w_scale_up = w_scale_gate + full_N;
             }
+            w_scale_gate += n0;
+            w_scale_up += n0;
 
             // When gate_up_type is COMBINED_UP_GATE, we need to swap the scales
             // to match the swapped weight layout
@@ -455,7 +488,7 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
 
             if (m_config.down_quantized) {
                 m_quant_up_act.M = M;
-                m_quant_up_act.K = m_config.up_size;
+                m_quant_up_act.K = m_N;
                 allocator.register_allocation(m_quant_up_act.size(), [&](void* ptr) {
                     m_quant_up_act.setup(ptr);
                 });
@@ -485,6 +518,17 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
         const auto& dstStrides = output->getDescWithType<BlockedMemoryDesc>()->getStrides();
         int strideC = dstStrides[dstStrides.size() - 2] * sizeof(T);
 
+        const auto& tp_cfg = m_pnode->m_tp_cfg;
+        if (tp_cfg.enable_tensor_parallel) {
+            // the partial output is accumulated in the private buffer which may still be read
+            // by the other ranks during the previous all-reduce
+            tp_cfg.communicator->wait_released(tp_cfg.w_rank);
+            const auto OC = output->getStaticDims().back();
+            OPENVINO_ASSERT(static_cast<size_t>(strideC) == OC * sizeof(T), "LLMMLP output is expected to be dense");
+            m_tp_dst.resize(M * OC);
+            dstC = m_tp_dst.data();
+        }
+
         float* p_w_scale_down = nullptr;
         if (m_config.down_quantized) {
             p_w_scale_down = m_pnode->getSrcMemoryAtPort(6)->getDataAs<float>();
@@ -527,6 +571,15 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
             pA += BM * strideA_in_bytes;
             dstC += BM * strideC / sizeof(T);
         }
+
+        if (tp_cfg.enable_tensor_parallel) {
+            tp_cfg.communicator->all_reduce(tp_cfg.w_rank,
+                                            m_tp_dst.data(),
+                                            output->getData(),
+                                            m_tp_dst.size(),
+                                            ov::element::from<T>(),
+                                            *m_pnode->context->getCpuParallel());
+        }
     }
 
 private:
@@ -554,6 +607,24 @@ LLMMLP::LLMMLP(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& co
     }
     const auto node_mlp = ov::as_type_ptr<const LLMMLPNode>(op);
     m_mlp_config = node_mlp->get_config();
+    m_tp_cfg = initTensorParallelConfig(context);
+}
+
+void LLMMLP::needUpdateTensorParallelConfig() {
+    // tensor parallel is disabled if the intermediate size is too small to give each rank a block
+    if (m_tp_cfg.enable_tensor_parallel) {
+#if defined(OPENVINO_ARCH_X86_64)
+        auto N = getInputShapeAtPort(1).getDims()[0];
+        if (m_mlp_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
+            N /= 2;
+        }
+        if (N % tp_block_size != 0 || N / tp_block_size < static_cast<size_t>(m_tp_cfg.w_size)) {
+            m_tp_cfg.enable_tensor_parallel = false;
+        }
+#else
+        m_tp_cfg.enable_tensor_parallel = false;
+#endif
+    }
 }
 
 void LLMMLP::initSupportedPrimitiveDescriptors() {
@@ -625,6 +696,7 @@ void LLMMLP::initSupportedPrimitiveDescriptors() {
 }
 
 void LLMMLP::createPrimitive() {
+    needUpdateTensorParallelConfig();
     auto rtPrecision = getInputPrecisions()[0];
 #ifdef OPENVINO_ARCH_X86_64
     if (rtPrecision == ov::element::bf16) {
@@ -9,6 +9,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
+#include "collectives.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
@@ -39,6 +40,8 @@ public:
                                      uint64_t fcDynamicQuantizationGroupSize = 0) noexcept;
 
 private:
+    void needUpdateTensorParallelConfig();
+
     struct ExecutorBase {
         virtual void execute() = 0;
         virtual ~ExecutorBase() = default;
@@ -47,6 +50,9 @@ private:
     template <typename T>
     struct Executor;
     LLMMLPNode::Config m_mlp_config{};
+    // Gate & Up are split by columns and Down by rows between the ranks, so the partial outputs
+    // of all the ranks are summed by a single all-reduce
+    TensorParallelConfig m_tp_cfg;
 };
 
 }  // namespace ov::intel_cpu::node
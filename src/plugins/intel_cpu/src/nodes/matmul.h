@@ -49,6 +49,9 @@ public:
 
     [[nodiscard]] bool neverExecute() const override;
     [[nodiscard]] bool isExecutable() const override;
+    [[nodiscard]] std::string getExecutorTuningInfo() const override {
+        return m_executor ? m_executor->tuningInfo() : std::string{};
+    }
 
 private:
     std::tuple<VecMemoryDescs, MemoryDescPtr> initMemoryDescriptors(ov::element::Type dstType) const;
@@ -0,0 +1,552 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "common/blocked_desc_creator.h"
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "node.h"
+#include "node_config.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/op/moe.hpp"
+#include "openvino/op/slice.hpp"
+#include "ov_ops/gather_matmul.hpp"
+#include "ov_ops/gather_matmul_compressed.hpp"
+#include "ov_ops/moe_compressed.hpp"
+#include "shape_inference/shape_inference_pass_through.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+/*
+MOE executes the GEMM3_SWIGLU mixture-of-experts block
+    out[t] = sum_k routing[t, k] * down_e(act(gate_e(x[t])) * up_e(x[t])),   e = topk_idx[t, k]
+without materializing the per-expert copies of the activations that the GatherMatmul decomposition needs:
+  1. routed rows (t * topK + k) are grouped by expert with a counting sort, so only active experts are visited
+     and each expert weight row is read (and decompressed) once per block of rows routed to it;
+  2. gate and up projections of a block are computed together and the activation is applied on the fly;
+  3. down projections are written per routed row and combined with the routing weights per token.
+Stages 1-2 and 3 are parallelized over (expert row block, output channel block), the combine over tokens.
+*/
+namespace {
+
+// number of routed rows of one expert sharing one decompressed weight row
+constexpr size_t rowBlockSize = 64;
+// number of output channels of one work item
+constexpr size_t channelBlockSize = 32;
+
+template <ov::element::Type_t WT>
+inline float weightAt(const uint8_t* data, size_t i) {
+    if constexpr (WT == ov::element::u8) {
+        return static_cast<float>(data[i]);
+    } else if constexpr (WT == ov::element::i8) {
+        return static_cast<float>(reinterpret_cast<const int8_t*>(data)[i]);
+    } else if constexpr (WT == ov::element::u4) {
+        return static_cast<float>((data[i >> 1] >> ((i & 1) * 4)) & 0xF);
+    } else {
+        static_assert(WT == ov::element::i4);
+        // move the nibble to the high half and shift it back to sign-extend it
+        const auto byte = static_cast<uint8_t>(data[i >> 1] << ((1 - (i & 1)) * 4));
+        return static_cast<float>(static_cast<int8_t>(byte) >> 4);
+    }
+}
+
+inline float scalarAt(const uint8_t* data, ov::element::Type type, size_t i) {
+    switch (type) {
+    case ov::element::f32:
+        return reinterpret_cast<const float*>(data)[i];
+    case ov::element::f16:
+        return static_cast<float>(reinterpret_cast<const ov::float16*>(data)[i]);
+    case ov::element::bf16:
+        return static_cast<float>(reinterpret_cast<const ov::bfloat16*>(data)[i]);
+    case ov::element::u8:
+        return weightAt<ov::element::u8>(data, i);
+    case ov::element::i8:
+        return weightAt<ov::element::i8>(data, i);
+    case ov::element::u4:
+        return weightAt<ov::element::u4>(data, i);
+    case ov::element::i4:
+        return weightAt<ov::element::i4>(data, i);
+    default:
+        OPENVINO_THROW("MOE: unsupported decompression parameter precision ", type);
+    }
+}
+
+template <ov::element::Type_t WT>
+void dequantizeRow(const uint8_t* weights,
+                   size_t row,
+                   size_t K,
+                   size_t groups,
+                   const uint8_t* scales,
+                   ov::element::Type scalesType,
+                   const uint8_t* zps,
+                   ov::element::Type zpType,
+                   bool scalarZp,
+                   float* dst) {
+    const size_t groupSize = K / groups;
+    for (size_t g = 0; g < groups; g++) {
+        const size_t param = row * groups + g;
+        const float scale = scalarAt(scales, scalesType, param);
+        const float zp = zps ? scalarAt(zps, zpType, scalarZp ? 0 : param) : 0.F;
+        const size_t base = row * K + g * groupSize;
+        float* out = dst + g * groupSize;
+        for (size_t i = 0; i < groupSize; i++) {
+            out[i] = (weightAt<WT>(weights, base + i) - zp) * scale;
+        }
+    }
+}
+
+inline float dot(const float* a, const float* b, size_t n) {
+    // independent partial sums let the compiler keep several vector accumulators in flight
+    std::array<float, 8> acc{};
+    size_t i = 0;
+    for (; i + acc.size() <= n; i += acc.size()) {
+        for (size_t l = 0; l < acc.size(); l++) {
+            acc[l] += a[i + l] * b[i + l];
+        }
+    }
+    float sum = std::accumulate(acc.begin(), acc.end(), 0.F);
+    for (; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+inline float activate(ov::op::internal::MOE::Activation_type type, float beta, float x) {
+    switch (type) {
+    case ov::op::internal::MOE::Activation_type::GEGLU_TANH: {
+        constexpr float sqrt_2_over_pi = 0.79788456080286535588F;
+        return 0.5F * x * (1.F + std::tanh(sqrt_2_over_pi * (x + 0.044715F * x * x * x)));
+    }
+    case ov::op::internal::MOE::Activation_type::GEGLU_ERF: {
+        constexpr float sqrt_1_2 = 0.70710678118654752440F;
+        return 0.5F * x * (1.F + std::erf(x * sqrt_1_2));
+    }
+    default:
+        return x / (1.F + std::exp(-beta * x));
+    }
+}
+
+inline void storeRow(const float* src, uint8_t* dst, ov::element::Type type, size_t offset, size_t count) {
+    switch (type) {
+    case ov::element::f16:
+        std::transform(src, src + count, reinterpret_cast<ov::float16*>(dst) + offset, [](float v) {
+            return ov::float16(v);
+        });
+        break;
+    case ov::element::bf16:
+        std::transform(src, src + count, reinterpret_cast<ov::bfloat16*>(dst) + offset, [](float v) {
+            return ov::bfloat16(v);
+        });
+        break;
+    default:
+        std::copy(src, src + count, reinterpret_cast<float*>(dst) + offset);
+    }
+}
+
+// returns an error message if the expert weights of one projection cannot be handled by the node
+std::string checkExpertWeights(const ov::Output<ov::Node>& weights,
+                               const ov::Output<ov::Node>* scales,
+                               const ov::Output<ov::Node>* zps) {
+    const auto& wShape = weights.get_partial_shape();
+    if (wShape.is_dynamic() || (wShape.size() != 3 && wShape.size() != 4)) {
+        return "expert weights must have a static [E, N, K] shape";
+    }
+    const auto& supportedWeights = MOE::getSupportedCompressedWeightsTypes();
+    const auto wType = weights.get_element_type();
+    if (!scales) {
+        return any_of(wType, ov::element::f32, ov::element::f16, ov::element::bf16)
+                   ? ""
+                   : "uncompressed expert weights must be floating point";
+    }
+    if (std::find(supportedWeights.begin(), supportedWeights.end(), wType) == supportedWeights.end()) {
+        return "unsupported compressed expert weights precision";
+    }
+    const auto& sShape = scales->get_partial_shape();
+    if (sShape.is_dynamic() || sShape.size() != 3 || sShape[0] != wShape[0] || sShape[1] != wShape[1]) {
+        return "decompression scales must have a static [E, N, G] shape";
+    }
+    if (none_of(scales->get_element_type(), ov::element::f32, ov::element::f16, ov::element::bf16)) {
+        return "unsupported decompression scales precision";
+    }
+    const auto K = ov::shape_size(wShape.to_shape()) /
+                   static_cast<size_t>(wShape[0].get_length() * wShape[1].get_length());
+    if (K % static_cast<size_t>(sShape[2].get_length()) != 0) {
+        return "decompression groups must evenly divide K";
+    }
+    if (zps && zps->get_element_type() != ov::element::dynamic) {
+        const auto& zpShape = zps->get_partial_shape();
+        if (zpShape.is_dynamic() || (zpShape != sShape && ov::shape_size(zpShape.to_shape()) != 1)) {
+            return "zero points must be scalar or have the shape of the scales";
+        }
+        if (none_of(zps->get_element_type(),
+                    ov::element::f32,
+                    ov::element::f16,
+                    ov::element::bf16,
+                    ov::element::u8,
+                    ov::element::i8,
+                    ov::element::u4,
+                    ov::element::i4)) {
+            return "unsupported zero points precision";
+        }
+    }
+    return "";
+}
+
+}  // namespace
+
+const float* MOE::ExpertWeights::row(size_t e, size_t n, float* buf) const {
+    const size_t r = e * N + n;
+    if (!compressed) {
+        switch (weightsType) {
+        case ov::element::f16: {
+            const auto* src = reinterpret_cast<const ov::float16*>(weights) + r * K;
+            std::transform(src, src + K, buf, [](ov::float16 v) {
+                return static_cast<float>(v);
+            });
+            return buf;
+        }
+        case ov::element::bf16: {
+            const auto* src = reinterpret_cast<const ov::bfloat16*>(weights) + r * K;
+            std::transform(src, src + K, buf, [](ov::bfloat16 v) {
+                return static_cast<float>(v);
+            });
+            return buf;
+        }
+        default:
+            return reinterpret_cast<const float*>(weights) + r * K;
+        }
+    }
+    const uint8_t* zpData = hasZp ? zps : nullptr;
+    switch (weightsType) {
+    case ov::element::u8:
+        dequantizeRow<ov::element::u8>(weights, r, K, groups, scales, scalesType, zpData, zpType, scalarZp, buf);
+        break;
+    case ov::element::i8:
+        dequantizeRow<ov::element::i8>(weights, r, K, groups, scales, scalesType, zpData, zpType, scalarZp, buf);
+        break;
+    case ov::element::u4:
+        dequantizeRow<ov::element::u4>(weights, r, K, groups, scales, scalesType, zpData, zpType, scalarZp, buf);
+        break;
+    case ov::element::i4:
+        dequantizeRow<ov::element::i4>(weights, r, K, groups, scales, scalesType, zpData, zpType, scalarZp, buf);
+        break;
+    default:
+        OPENVINO_THROW("MOE: unsupported expert weights precision ", weightsType);
+    }
+    return buf;
+}
+
+const std::vector<ov::element::Type>& MOE::getSupportedCompressedWeightsTypes() {
+    static const std::vector<ov::element::Type> supportedTypes{ov::element::u8,
+                                                               ov::element::i8,
+                                                               ov::element::u4,
+                                                               ov::element::i4};
+    return supportedTypes;
+}
+
+MOE::MOE(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, PassThroughShapeInferFactory()) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto moe = ov::as_type_ptr<const ov::op::internal::MOE>(op);
+    m_config = moe->get_config();
+    m_compressed = ov::is_type<ov::op::internal::MOECompressed>(op);
+    // MOECompressed may request a narrower output type, the computation itself is always f32
+    const auto outputType = op->get_output_element_type(0);
+    m_outputType = any_of(outputType, ov::element::f16, ov::element::bf16) ? outputType : ov::element::f32;
+
+    // MOE: hidden, routing, topk_idx, gate_w, up_w, down_w
+    // MOECompressed: hidden, routing, topk_idx, (w, scale, zp) x {gate, up, down}
+    for (size_t p = GATE; p <= DOWN; p++) {
+        auto& w = m_weights[p];
+        w.compressed = m_compressed;
+        w.weightsPort = m_compressed ? 3 + p * 3 : 3 + p;
+        const auto wShape = op->get_input_shape(w.weightsPort);
+        m_numExperts = wShape[0];
+        w.N = wShape[1];
+        w.K = ov::shape_size(wShape) / (wShape[0] * wShape[1]);
+        // f16/bf16 weights are converted row by row at execution instead of being reordered to f32
+        w.weightsType = op->get_input_element_type(w.weightsPort);
+        if (m_compressed) {
+            w.scalesPort = w.weightsPort + 1;
+            w.zpPort = w.weightsPort + 2;
+            w.groups = op->get_input_shape(w.scalesPort)[2];
+            w.scalesType = op->get_input_element_type(w.scalesPort);
+            w.zpType = op->get_input_element_type(w.zpPort);
+            w.hasZp = w.zpType != ov::element::dynamic;
+            w.scalarZp = w.hasZp && ov::shape_size(op->get_input_shape(w.zpPort)) == 1;
+        }
+    }
+}
+
+bool MOE::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto moe = ov::as_type_ptr<const ov::op::internal::MOE>(op);
+        if (!moe) {
+            errorMessage = "Only MOE and MOECompressed operations are supported";
+            return false;
+        }
+        if (moe->get_config().expert_type != ov::op::internal::MOE::Expert_type::GEMM3_SWIGLU) {
+            errorMessage = "Only GEMM3_SWIGLU expert type is supported";
+            return false;
+        }
+        const auto compressed = ov::as_type_ptr<const ov::op::internal::MOECompressed>(op);
+        if (compressed && compressed->get_config().num_shared_expert != 0) {
+            errorMessage = "Shared experts are not supported";
+            return false;
+        }
+        const size_t expectedInputs = compressed ? 12 : 6;
+        if (op->get_input_size() != expectedInputs) {
+            errorMessage = "Unexpected number of inputs";
+            return false;
+        }
+        for (size_t p = GATE; p <= DOWN; p++) {
+            std::string error;
+            if (compressed) {
+                const size_t port = 3 + p * 3;
+                const auto scales = op->input_value(port + 1);
+                const auto zps = op->input_value(port + 2);
+                error = checkExpertWeights(op->input_value(port), &scales, &zps);
+            } else {
+                error = checkExpertWeights(op->input_value(3 + p), nullptr, nullptr);
+            }
+            if (!error.empty()) {
+                errorMessage = error;
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+bool MOE::isUnsupportedMoeBlock(const std::shared_ptr<const ov::Node>& root) {
+    // root is the end Reshape of: ReduceSum(Multiply(down, Unsqueeze(Transpose([Slice](routing)))))
+    const auto multiply = root->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+    const auto routingTranspose = multiply->get_input_node_shared_ptr(1)->get_input_node_shared_ptr(0);
+    // the fused op would consume the routing weights before the Slice
+    if (ov::is_type<ov::op::v8::Slice>(routingTranspose->get_input_node_ptr(0))) {
+        return true;
+    }
+    const auto down = multiply->get_input_node_shared_ptr(0);
+    const auto swiglu = down->get_input_node_shared_ptr(0);
+    const auto gate = swiglu->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+    const auto up = swiglu->get_input_node_shared_ptr(1);
+    // MOECompressed carries a single group size and zero point flag for all projections
+    std::vector<size_t> groupSizes;
+    std::vector<bool> hasZps;
+    for (const auto& gatherMatmul : {gate, up, down}) {
+        if (!ov::is_type<ov::op::internal::GatherMatmul>(gatherMatmul)) {
+            return true;
+        }
+        // the fused op has no bias input
+        if (gatherMatmul->get_input_element_type(3) != ov::element::dynamic) {
+            return true;
+        }
+        std::string error;
+        if (ov::is_type<ov::op::internal::GatherMatmulCompressed>(gatherMatmul)) {
+            const auto scales = gatherMatmul->input_value(4);
+            const auto zps = gatherMatmul->input_value(5);
+            error = checkExpertWeights(gatherMatmul->input_value(1), &scales, &zps);
+            if (error.empty()) {
+                const auto wShape = gatherMatmul->get_input_shape(1);
+                const auto groups = scales.get_shape()[2];
+                groupSizes.push_back(groups == 1 ? 0 : ov::shape_size(wShape) / (wShape[0] * wShape[1] * groups));
+                hasZps.push_back(zps.get_element_type() != ov::element::dynamic);
+            }
+        } else {
+            error = checkExpertWeights(gatherMatmul->input_value(1), nullptr, nullptr);
+        }
+        if (!error.empty()) {
+            return true;
+        }
+    }
+    const auto allEqual = [](const auto& values) {
+        return std::adjacent_find(values.begin(), values.end(), std::not_equal_to<>()) == values.end();
+    };
+    return !allEqual(groupSizes) || !allEqual(hasZps);
+}
+
+void MOE::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
+    auto makeDesc = [&](const Shape& shape, ov::element::Type precision) -> MemoryDescPtr {
+        if (precision == ov::element::dynamic) {
+            return MemoryDescUtils::makeEmptyDesc();
+        }
+        return creatorsMap.at(LayoutType::ncsp)->createSharedDesc(precision, shape);
+    };
+
+    NodeConfig config;
+    config.inConfs.resize(getOriginalInputsNumber());
+    config.inConfs[0] = PortConfig{makeDesc(getInputShapeAtPort(0), ov::element::f32)};
+    config.inConfs[1] = PortConfig{makeDesc(getInputShapeAtPort(1), ov::element::f32)};
+    config.inConfs[2] = PortConfig{makeDesc(getInputShapeAtPort(2), ov::element::i32)};
+    for (const auto& w : m_weights) {
+        config.inConfs[w.weightsPort] = PortConfig{makeDesc(getInputShapeAtPort(w.weightsPort), w.weightsType)};
+        if (w.compressed) {
+            config.inConfs[w.scalesPort] = PortConfig{makeDesc(getInputShapeAtPort(w.scalesPort), w.scalesType)};
+            config.inConfs[w.zpPort] = PortConfig{makeDesc(getInputShapeAtPort(w.zpPort), w.zpType)};
+        }
+    }
+    config.outConfs.emplace_back(makeDesc(getOutputShapeAtPort(0), m_outputType));
+
+    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref_any);
+}
+
+void MOE::bindWeights(ExpertWeights& w) const {
+    w.weights = getSrcDataAtPortAs<const uint8_t>(w.weightsPort);
+    if (w.compressed) {
+        w.scales = getSrcDataAtPortAs<const uint8_t>(w.scalesPort);
+        w.zps = w.hasZp ? getSrcDataAtPortAs<const uint8_t>(w.zpPort) : nullptr;
+    }
+}
+
+void MOE::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& srcDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const size_t hiddenSize = srcDims.back();
+    const size_t tokens = ov::shape_size(srcDims) / hiddenSize;
+    const size_t topK = getSrcMemoryAtPort(2)->getStaticDims().back();
+    const size_t routed = tokens * topK;
+
+    const auto* src = getSrcDataAtPortAs<const float>(0);
+    const auto* routing = getSrcDataAtPortAs<const float>(1);
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(2);
+    auto* dst = getDstDataAtPortAs<uint8_t>(0);
+
+    for (auto& w : m_weights) {
+        bindWeights(w);
+    }
+    const auto& gate = m_weights[GATE];
+    const auto& up = m_weights[UP];
+    const auto& down = m_weights[DOWN];
+    const size_t interSize = gate.N;
+    CPU_NODE_ASSERT(gate.K == hiddenSize && up.K == hiddenSize && up.N == interSize && down.N == hiddenSize &&
+                        down.K == interSize,
+                    "has inconsistent expert weights shapes");
+
+    // group routed rows by expert, the counting sort keeps the token order inside each expert
+    m_expertOffsets.assign(m_numExperts + 1, 0);
+    for (size_t j = 0; j < routed; j++) {
+        const auto e = indices[j];
+        CPU_NODE_ASSERT(e >= 0 && static_cast<size_t>(e) < m_numExperts, "got out of range expert index ", e);
+        m_expertOffsets[e + 1]++;
+    }
+    std::partial_sum(m_expertOffsets.begin(), m_expertOffsets.end(), m_expertOffsets.begin());
+    std::vector<size_t> cursor(m_expertOffsets.begin(), m_expertOffsets.end() - 1);
+    m_rows.resize(routed);
+    for (size_t j = 0; j < routed; j++) {
+        m_rows[cursor[indices[j]]++] = j;
+    }
+    m_blocks.clear();
+    for (size_t e = 0; e < m_numExperts; e++) {
+        for (size_t begin = m_expertOffsets[e]; begin < m_expertOffsets[e + 1]; begin += rowBlockSize) {
+            m_blocks.push_back({e, begin, std::min(begin + rowBlockSize, m_expertOffsets[e + 1])});
+        }
+    }
+
+    m_intermediate.resize(routed * interSize);
+    m_expertOutput.resize(routed * hiddenSize);
+    const auto& cpuParallel = context->getCpuParallel();
+    const auto activationType = m_config.activation_type;
+    const auto beta = m_config.expert_beta;
+
+    // the work items are statically split over the threads, each thread converts the weight rows into its own slice
+    // of the scratch buffer: the gate and up rows (2 * hiddenSize) or the down row (interSize)
+    const size_t scratchSize = std::max(2 * hiddenSize, interSize);
+    const auto runBlocks = [&](size_t channels, const auto& body) {
+        const size_t channelBlocks = div_up(channels, channelBlockSize);
+        const size_t nthr =
+            std::min(static_cast<size_t>(cpuParallel->get_num_threads()), m_blocks.size() * channelBlocks);
+        m_rowScratch.resize(nthr * scratchSize);
+        cpuParallel->parallel_for(nthr, [&](size_t ithr) {
+            float* buf = m_rowScratch.data() + ithr * scratchSize;
+            for_2d(static_cast<int>(ithr),
+                   static_cast<int>(nthr),
+                   m_blocks.size(),
+                   channelBlocks,
+                   [&](size_t b, size_t cb) {
+                       const size_t cEnd = std::min((cb + 1) * channelBlockSize, channels);
+                       body(m_blocks[b], cb * channelBlockSize, cEnd, buf);
+                   });
+        });
+    };
+
+    // gate/up projections with the fused activation: intermediate[j] = act(x[t] * gate^T) * (x[t] * up^T)
+    runBlocks(interSize, [&](const RowBlock& block, size_t nBegin, size_t nEnd, float* buf) {
+        for (size_t n = nBegin; n < nEnd; n++) {
+            const float* gateRow = gate.row(block.expert, n, buf);
+            const float* upRow = up.row(block.expert, n, buf + hiddenSize);
+            for (size_t r = block.begin; r < block.end; r++) {
+                const size_t j = m_rows[r];
+                const float* x = src + (j / topK) * hiddenSize;
+                const float g = dot(x, gateRow, hiddenSize);
+                const float u = dot(x, upRow, hiddenSize);
+                m_intermediate[j * interSize + n] = activate(activationType, beta, g) * u;
+            }
+        }
+    });
+
+    // down projection of every routed row
+    runBlocks(hiddenSize, [&](const RowBlock& block, size_t hBegin, size_t hEnd, float* buf) {
+        for (size_t h = hBegin; h < hEnd; h++) {
+            const float* downRow = down.row(block.expert, h, buf);
+            for (size_t r = block.begin; r < block.end; r++) {
+                const size_t j = m_rows[r];
+                m_expertOutput[j * hiddenSize + h] = dot(m_intermediate.data() + j * interSize, downRow, interSize);
+            }
+        }
+    });
+
+    // weighted combine of the top-k expert outputs of every token, accumulated in the row of its first expert
+    cpuParallel->parallel_for(tokens, [&](size_t t) {
+        float* acc = m_expertOutput.data() + t * topK * hiddenSize;
+        const float firstWeight = routing[t * topK];
+        for (size_t h = 0; h < hiddenSize; h++) {
+            acc[h] *= firstWeight;
+        }
+        for (size_t k = 1; k < topK; k++) {
+            const float weight = routing[t * topK + k];
+            const float* y = acc + k * hiddenSize;
+            for (size_t h = 0; h < hiddenSize; h++) {
+                acc[h] += weight * y[h];
+            }
+        }
+        storeRow(acc, dst, m_outputType, t * hiddenSize, hiddenSize);
+    });
+}
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/moe.hpp"
+
+namespace ov::intel_cpu::node {
+
+class MOE : public Node {
+public:
+    MOE(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    bool created() const override {
+        return getType() == Type::MOE;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+    bool isExecutable() const override {
+        return !isInputTensorAtPortEmpty(0);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+    // Used as the MOE fusion callback: true if the 3-GEMM GatherMatmul block ending at 'root'
+    // would produce a MOE/MOECompressed op this node cannot execute, so the fusion must be skipped.
+    static bool isUnsupportedMoeBlock(const std::shared_ptr<const ov::Node>& root);
+    static const std::vector<ov::element::Type>& getSupportedCompressedWeightsTypes();
+
+private:
+    enum Projection : uint8_t { GATE = 0, UP = 1, DOWN = 2 };
+
+    // Expert weights of one projection, [E, N, K] (optionally compressed with [E, N, G] scales/zero points)
+    struct ExpertWeights {
+        size_t weightsPort = 0;
+        size_t scalesPort = 0;
+        size_t zpPort = 0;
+        bool compressed = false;
+        bool hasZp = false;
+        bool scalarZp = false;
+        size_t N = 0;
+        size_t K = 0;
+        size_t groups = 1;
+
+        const uint8_t* weights = nullptr;
+        const uint8_t* scales = nullptr;
+        const uint8_t* zps = nullptr;
+        ov::element::Type weightsType;
+        ov::element::Type scalesType;
+        ov::element::Type zpType;
+
+        // returns row n of expert e as f32, converting or decompressing into 'buf' (K elements) if needed
+        const float* row(size_t e, size_t n, float* buf) const;
+    };
+
+    // a run of routed rows of one expert, the unit of work of the expert GEMMs
+    struct RowBlock {
+        size_t expert;
+        size_t begin;
+        size_t end;
+    };
+
+    void bindWeights(ExpertWeights& w) const;
+
+    ov::op::internal::MOE::Config m_config;
+    bool m_compressed = false;
+    ov::element::Type m_outputType = ov::element::f32;
+    size_t m_numExperts = 0;
+    std::array<ExpertWeights, 3> m_weights;
+
+    // routed rows (token * topK + k) grouped by expert
+    std::vector<size_t> m_expertOffsets;
+    std::vector<size_t> m_rows;
+    std::vector<RowBlock> m_blocks;
+    std::vector<float> m_intermediate;
+    std::vector<float> m_expertOutput;
+    std::vector<float> m_rowScratch;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -27,10 +27,12 @@
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include <algorithm>
+#    include <array>
 #    include <type_traits>
 #    include <utility>
 
 #    include "cpu_memory.h"
+#    include "cpu_parallel.hpp"
 #    include "dnnl_scratch_pad.h"
 #    include "kernels/x64/mlp_utils.hpp"
 #    include "memory_desc/blocked_memory_desc.h"
@@ -90,6 +92,11 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
 
     WeightBuffer wbuffer;
 
+    // tensor parallel: [offset, size) columns of each projection computed by the rank
+    // and the private buffers of the results which are read by the other ranks during gather
+    std::array<std::pair<size_t, size_t>, 3> m_tp_parts;
+    std::array<std::vector<T>, 3> m_tp_dst;
+
     Executor(QKVProjection* pnode, DnnlScratchPadPtr scrachPad) : m_node(pnode), m_scrachPad(std::move(scrachPad)) {
         PlainTensor w0(pnode->getSrcMemoryAtPort(1));
         PlainTensor w1(pnode->getSrcMemoryAtPort(2));
@@ -141,22 +148,34 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
                 start_blkN += blkN;
             }
         };
-        auto proj_size0 = m_node->m_config.proj_size0;
-        auto proj_size1 = m_node->m_config.proj_size1;
-        auto proj_size2 = m_node->m_config.proj_size2;
+        const std::array<int, 3> proj_sizes = {m_node->m_config.proj_size0,
+                                                m_node->m_config.proj_size1,
+                                                m_node->m_config.proj_size2};
+        const auto& tp_cfg = m_node->m_tp_cfg;
+        for (size_t i = 0; i < proj_sizes.size(); i++) {
+            m_tp_parts[i] = {0, static_cast<size_t>(proj_sizes[i])};
+            if (tp_cfg.enable_tensor_parallel) {
+                const auto blocks = static_cast<size_t>(proj_sizes[i] / REG_BLK_N_SIZE);
+                auto [blk_offset, blk_num] = tp_cfg.communicator->get_part(tp_cfg.w_rank, blocks);
+                m_tp_parts[i] = {blk_offset * REG_BLK_N_SIZE, blk_num * REG_BLK_N_SIZE};
+            }
+        }
+        auto proj_size0 = static_cast<int>(m_tp_parts[0].second);
+        auto proj_size1 = static_cast<int>(m_tp_parts[1].second);
+        auto proj_size2 = static_cast<int>(m_tp_parts[2].second);
         auto n_group_workers = allocate_workers({proj_size0, proj_size1, proj_size2}, m_threads_num);
 
         if (m_node->m_config.weights_combined) {
             auto* ptr_weights = reinterpret_cast<int8_t*>(w0.ptr_v());
-            create_works(ptr_weights, 0, proj_size0, n_group_workers[0]);
-            ptr_weights += proj_size0 * stride_in_bytes;
-            create_works(ptr_weights, 1, proj_size1, n_group_workers[1]);
-            ptr_weights += proj_size1 * stride_in_bytes;
-            create_works(ptr_weights, 2, proj_size2, n_group_workers[2]);
+            create_works(ptr_weights + m_tp_parts[0].first * stride_in_bytes, 0, proj_size0, n_group_workers[0]);
+            ptr_weights += proj_sizes[0] * stride_in_bytes;
+            create_works(ptr_weights + m_tp_parts[1].first * stride_in_bytes, 1, proj_size1, n_group_workers[1]);
+            ptr_weights += proj_sizes[1] * stride_in_bytes;
+            create_works(ptr_weights + m_tp_parts[2].first * stride_in_bytes, 2, proj_size2, n_group_workers[2]);
         } else {
-            create_works(w0.ptr_v(), 0, proj_size0, n_group_workers[0]);
-            create_works(w1.ptr_v(), 1, proj_size1, n_group_workers[1]);
-            create_works(w2.ptr_v(), 2, proj_size2, n_group_workers[2]);
+            create_works(w0.ptr_v(m_tp_parts[0].first, 0), 0, proj_size0, n_group_workers[0]);
+            create_works(w1.ptr_v(m_tp_parts[1].first, 0), 1, proj_size1, n_group_workers[1]);
+            create_works(w2.ptr_v(m_tp_parts[2].first, 0), 2, proj_size2, n_group_workers[2]);
         }
 
         DEBUG_LOG("QKVProj hidden_size=",
@@ -246,6 +265,9 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
                 w_scale[1] = m_node->getSrcMemoryAtPort(5)->getDataAs<float>();
                 w_scale[2] = m_node->getSrcMemoryAtPort(6)->getDataAs<float>();
             }
+            for (size_t i = 0; i < m_tp_parts.size(); i++) {
+                w_scale[i] += m_tp_parts[i].first;
+            }
         }
 
         const auto& srcStrides = input->getDescWithType<BlockedMemoryDesc>()->getStrides();
@@ -258,6 +280,27 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         auto stride_dst_1 = dstStrides1[1];
         auto stride_dst_2 = dstStrides2[1];
 
+        const auto& tp_cfg = m_node->m_tp_cfg;
+        std::array<void*, 3> outputs = {dst0, dst1, dst2};
+        if (tp_cfg.enable_tensor_parallel) {
+            // the results of the rank are computed into the private buffers which may still be read
+            // by the other ranks during the previous gather
+            tp_cfg.communicator->wait_released(tp_cfg.w_rank);
+            OPENVINO_ASSERT(stride_dst_0 == static_cast<size_t>(m_node->m_config.proj_size0) &&
+                                stride_dst_1 == static_cast<size_t>(m_node->m_config.proj_size1) &&
+                                stride_dst_2 == static_cast<size_t>(m_node->m_config.proj_size2),
+                            "QKVProjection outputs are expected to be dense");
+            for (size_t i = 0; i < m_tp_dst.size(); i++) {
+                m_tp_dst[i].resize(M * m_tp_parts[i].second);
+            }
+            dst0 = m_tp_dst[0].data();
+            dst1 = m_tp_dst[1].data();
+            dst2 = m_tp_dst[2].data();
+            stride_dst_0 = m_tp_parts[0].second;
+            stride_dst_1 = m_tp_parts[1].second;
+            stride_dst_2 = m_tp_parts[2].second;
+        }
+
         auto asym = true;
         for (int m = 0; m < M;) {
             int BM = std::min(M - m, CACHE_BLK_M_SIZE);
@@ -325,6 +368,17 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
             dst1 += BM * stride_dst_1;
             dst2 += BM * stride_dst_2;
         }
+
+        if (tp_cfg.enable_tensor_parallel) {
+            for (size_t i = 0; i < m_tp_dst.size(); i++) {
+                tp_cfg.communicator->all_gather(tp_cfg.w_rank,
+                                                m_tp_dst[i].data(),
+                                                m_tp_parts[i].second * sizeof(T),
+                                                outputs[i],
+                                                M,
+                                                *m_node->context->getCpuParallel());
+            }
+        }
     }
 };
 #else
@@ -337,6 +391,7 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
 #endif
 
 void QKVProjection::createPrimitive() {
+    needUpdateTensorParallelConfig();
     auto rtPrecision = getInputPrecisions()[0];
 #ifdef OPENVINO_ARCH_X86_64
     if (rtPrecision == ov::element::bf16) {
@@ -369,6 +424,23 @@ QKVProjection::QKVProjection(const std::shared_ptr<ov::Node>& op, const GraphCon
     }
     const auto node = ov::as_type_ptr<const QKVProjectionNode>(op);
     m_config = node->get_config();
+    m_tp_cfg = initTensorParallelConfig(context);
+}
+
+void QKVProjection::needUpdateTensorParallelConfig() {
+    // tensor parallel is disabled if any projection is too small to give each rank a block of columns
+    // or the outputs are not dense, since the results are gathered by rows
+    if (m_tp_cfg.enable_tensor_parallel) {
+#if defined(OPENVINO_ARCH_X86_64)
+        for (auto proj_size : {m_config.proj_size0, m_config.proj_size1, m_config.proj_size2}) {
+            if (proj_size / REG_BLK_N_SIZE < m_tp_cfg.w_size) {
+                m_tp_cfg.enable_tensor_parallel = false;
+            }
+        }
+#else
+        m_tp_cfg.enable_tensor_parallel = false;
+#endif
+    }
 }
 
 void QKVProjection::initSupportedPrimitiveDescriptors() {
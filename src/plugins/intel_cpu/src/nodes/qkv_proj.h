@@ -9,6 +9,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
+#include "collectives.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
@@ -43,6 +44,8 @@ public:
                                      uint64_t fcDynamicQuantizationGroupSize = 0) noexcept;
 
 private:
+    void needUpdateTensorParallelConfig();
+
     struct ExecutorBase {
         virtual void execute() = 0;
         virtual ~ExecutorBase() = default;
@@ -52,6 +55,8 @@ private:
     struct Executor;
 
     QKVProjectionNode::Config m_config = {};
+    // Each of Q, K and V projections is split by columns between the ranks, the results are gathered
+    TensorParallelConfig m_tp_cfg;
 };
 
 }  // namespace ov::intel_cpu::node
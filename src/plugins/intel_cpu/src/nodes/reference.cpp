@@ -5,7 +5,9 @@
 #include "reference.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -14,6 +16,7 @@
 
 #include "common/cpu_memcpy.h"
 #include "cpu_memory.h"
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -21,10 +24,16 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/grn.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "shape_inference/shape_inference_status.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu::node {
 
@@ -66,11 +75,144 @@ void Reference::initSupportedPrimitiveDescriptors() {
 
 void Reference::createPrimitive() {
     hasOutputShapeDataDependency = isDynamicNode() && outputShapeDataDependency();
+    splitMode = getSplitMode();
+    DEBUG_LOG("Reference fallback for ",
+              getName(),
+              " (",
+              ovCoreNode->get_type_info(),
+              ")",
+              splitMode != SplitMode::none ? " with split execution" : "");
+}
+
+Reference::SplitMode Reference::getSplitMode() const {
+    if (hasOutputShapeDataDependency || outputShapes.empty()) {
+        return SplitMode::none;
+    }
+    // the slices are addressed by byte offsets, so sub-byte and string types are not split
+    auto splittable = [](const ov::element::Type& type) {
+        return type != ov::element::string && type.bitwidth() >= 8;
+    };
+    for (size_t i = 0; i < ovCoreNode->get_input_size(); i++) {
+        if (!splittable(ovCoreNode->get_input_element_type(i))) {
+            return SplitMode::none;
+        }
+    }
+    for (size_t i = 0; i < ovCoreNode->get_output_size(); i++) {
+        if (!splittable(ovCoreNode->get_output_element_type(i))) {
+            return SplitMode::none;
+        }
+    }
+
+    // GRN derives from the unary elementwise base class but normalizes across channels
+    if (ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(ovCoreNode) &&
+        !ov::is_type<ov::op::v0::GRN>(ovCoreNode)) {
+        return SplitMode::elements;
+    }
+    const auto& rtInfo = ovCoreNode->get_rt_info();
+    const auto it = rtInfo.find(batchSeparableKey);
+    if (it != rtInfo.end() && it->second.is<bool>() && it->second.as<bool>()) {
+        return SplitMode::batch;
+    }
+    return SplitMode::none;
+}
+
+bool Reference::executeSplit(const ov::TensorVector& inputs, const ov::TensorVector& outputs) const {
+    // slices smaller than that are not worth the parallel dispatch
+    constexpr size_t minSliceBytes = 16 * 1024;
+
+    size_t workAmount = 0;
+    size_t totalBytes = 0;
+    if (splitMode == SplitMode::elements) {
+        if (inputs.size() != 1 || outputs.size() != 1) {
+            return false;
+        }
+        workAmount = inputs[0].get_size();
+        totalBytes = inputs[0].get_byte_size();
+        if (outputs[0].get_size() != workAmount) {
+            return false;
+        }
+    } else {
+        auto sameBatch = [&](const ov::Tensor& tensor) {
+            return !tensor.get_shape().empty() && tensor.get_shape()[0] == workAmount;
+        };
+        workAmount = inputs.empty() || inputs[0].get_shape().empty() ? 0 : inputs[0].get_shape()[0];
+        for (const auto& tensor : inputs) {
+            totalBytes += tensor.get_byte_size();
+        }
+        if (!std::all_of(inputs.begin(), inputs.end(), sameBatch) ||
+            !std::all_of(outputs.begin(), outputs.end(), sameBatch)) {
+            return false;
+        }
+    }
+
+    const auto& cpuParallel = context->getCpuParallel();
+    const auto nthr = std::min({static_cast<size_t>(cpuParallel->get_num_threads()),
+                                workAmount,
+                                totalBytes / minSliceBytes});
+    if (nthr < 2) {
+        return false;
+    }
+
+    auto slice = [&](const ov::Tensor& tensor, size_t start, size_t end) {
+        auto* data = static_cast<uint8_t*>(tensor.data());
+        if (splitMode == SplitMode::elements) {
+            return ov::Tensor(tensor.get_element_type(),
+                              ov::Shape{end - start},
+                              data + start * tensor.get_element_type().size());
+        }
+        auto shape = tensor.get_shape();
+        const auto rowBytes = tensor.get_byte_size() / shape[0];
+        shape[0] = end - start;
+        return ov::Tensor(tensor.get_element_type(), shape, data + start * rowBytes);
+    };
+
+    std::atomic<bool> success{true};
+    cpuParallel->parallel_for(nthr, [&](size_t ithr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+        ov::TensorVector sliceInputs;
+        ov::TensorVector sliceOutputs;
+        sliceInputs.reserve(inputs.size());
+        sliceOutputs.reserve(outputs.size());
+        for (const auto& tensor : inputs) {
+            sliceInputs.push_back(slice(tensor, start, end));
+        }
+        for (const auto& tensor : outputs) {
+            sliceOutputs.push_back(slice(tensor, start, end));
+        }
+        if (!ovCoreNode->evaluate(sliceOutputs, sliceInputs)) {
+            success = false;
+        }
+    });
+    if (!success) {
+        CPU_NODE_THROW("evaluation failed for core operation: ", std::string(ovCoreNode->get_type_name()));
+    }
+    return true;
+}
+
+std::string Reference::getFallbackInfo() const {
+    std::string mode = "none";
+    if (splitMode == SplitMode::elements) {
+        mode = "elements";
+    } else if (splitMode == SplitMode::batch) {
+        mode = "batch";
+    }
+    return std::string(ovCoreNode->get_type_name()) + ";split=" + mode +
+           ";splitExecutions=" + std::to_string(splitExecutions) + "/" + std::to_string(executions);
 }
 
 void Reference::execute([[maybe_unused]] const dnnl::stream& strm) {
     auto inputs = prepareInputs();
     auto outputs = prepareOutputs();
+    executions++;
+    if (splitMode != SplitMode::none && executeSplit(inputs, outputs)) {
+        splitExecutions++;
+        return;
+    }
     if (!ovCoreNode->evaluate(outputs, inputs)) {
         CPU_NODE_THROW("evaluation failed for core operation: ", std::string(ovCoreNode->get_type_name()));
     }
@@ -6,12 +6,15 @@
 
 #include <node.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
 #include "graph_context.h"
 #include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
 #include "openvino/runtime/tensor.hpp"
 
 namespace ov::intel_cpu::node {
@@ -38,13 +41,38 @@ public:
     }
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
+    // The rt_info key a model or an extension may set on an operation to declare that its evaluate() can be applied
+    // to independent slices along the first (batch) axis of all the inputs and outputs
+    static constexpr const char* batchSeparableKey = "cpu_reference_batch_separable";
+
+    const ov::DiscreteTypeInfo& getCoreOpType() const {
+        return ovCoreNode->get_type_info();
+    }
+    bool isSplitExecution() const {
+        return splitMode != SplitMode::none;
+    }
+    // The fallback report exposed as an execution graph attribute: the core operation type, the split mode and
+    // how many of the executions were actually split
+    std::string getFallbackInfo() const;
+
 private:
+    enum class SplitMode : uint8_t {
+        none,
+        elements,  // unary elementwise operation, the flattened tensors are split
+        batch,     // declared batch separable, the tensors are split along the first axis
+    };
+
     ov::TensorVector prepareInputs() const;
     ov::TensorVector prepareOutputs() const;
+    SplitMode getSplitMode() const;
+    bool executeSplit(const ov::TensorVector& inputs, const ov::TensorVector& outputs) const;
 
     const std::shared_ptr<ov::Node> ovCoreNode;
     const std::string additionalErrorMessage;
     bool hasOutputShapeDataDependency = false;  // flag to cache the output shape data dependency check result
+    SplitMode splitMode = SplitMode::none;
+    size_t executions = 0;
+    size_t splitExecutions = 0;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -21,6 +21,8 @@
 #include "cpu_parallel.hpp"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
+#include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -61,6 +63,7 @@
 #endif
 
 #include <algorithm>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -1845,6 +1848,101 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     } else if (const auto node = ov::as_type_ptr<const SDPAWithTransposeReshape>(op)) {
         m_config.config = node->get_config();
     }
+    m_tp_cfg = SDPATensorParallelConfig(initTensorParallelConfig(context));
+}
+
+void ScaledDotProductAttention::needUpdateTensorParallelConfig() {
+    // The split must not change between the inferences since the KV cache keeps the heads of the rank only,
+    // so tensor parallel is enabled only for the stateful attention with static number of heads:
+    // 1. the KV cache is fused and inputs are [B,H,L,S] up to permutation
+    // 2. there is no alibi and sink inputs and attention mask is broadcasted by heads
+    // 3. each rank gets at least one KV head
+    if (!m_tp_cfg.enable_tensor_parallel) {
+        return;
+    }
+    const auto& config = m_config.config;
+    const auto orginSDPInputNumber = getOriginalInputsNumber() - (config.fuse_concat ? 3 : 0);
+    m_tp_cfg.enable_tensor_parallel = false;
+    if (!config.fuse_concat || config.input_BLHxS || config.output_BLHxS || orginSDPInputNumber > 5) {
+        return;
+    }
+    const auto head_axis = config.permute_axes.empty() ? 1 : config.permute_axes[1];
+    const auto H = getInputShapeAtPort(0).getDims()[head_axis];
+    const auto Hk = getInputShapeAtPort(1).getDims()[head_axis];
+    if (any_of(Shape::UNDEFINED_DIM, H, Hk) || H % Hk != 0 || Hk < static_cast<size_t>(m_tp_cfg.w_size)) {
+        return;
+    }
+    if (orginSDPInputNumber > 3) {
+        const auto& mask_dims = getInputShapeAtPort(3).getDims();
+        if (mask_dims.size() >= 3 && mask_dims[mask_dims.size() - 3] != 1) {
+            return;
+        }
+    }
+    m_tp_cfg.enable_tensor_parallel = true;
+}
+
+// Returns the view of [start, start + count) heads of the plain memory
+static MemoryPtr split_heads(const dnnl::engine& eng,
+                             const MemoryPtr& mem,
+                             size_t head_axis,
+                             size_t start,
+                             size_t count) {
+    const auto desc = mem->getDescWithType<BlockedMemoryDesc>();
+    const auto& strides = desc->getStrides();
+    auto dims = mem->getStaticDims();
+    dims[head_axis] = count;
+    VectorDims order(dims.size());
+    std::iota(order.begin(), order.end(), 0);
+    OPENVINO_ASSERT(desc->getOrder() == order, "Heads can be split for plain layout only");
+    const auto& prec = desc->getPrecision();
+    auto view_desc = std::make_shared<CpuBlockedMemoryDesc>(prec,
+                                                            Shape(dims),
+                                                            dims,
+                                                            order,
+                                                            0,
+                                                            VectorDims(dims.size(), 0),
+                                                            strides);
+    auto* data = mem->getDataAs<uint8_t>() + start * strides[head_axis] * prec.size();
+    return std::make_shared<Memory>(eng, view_desc, data, false);
+}
+
+void ScaledDotProductAttention::prepareTensorParallelMemory(std::vector<MemoryPtr>& inputs, MemoryPtr& output) {
+    const auto& permute_axes = m_config.config.permute_axes;
+    const auto head_axis = permute_axes.empty() ? 1 : permute_axes[1];
+    const auto H = inputs[0]->getStaticDims()[head_axis];
+    const auto Hk = inputs[1]->getStaticDims()[head_axis];
+    const auto group = H / Hk;
+    const auto [hk_start, hk_count] = m_tp_cfg.communicator->get_part(m_tp_cfg.w_rank, Hk);
+
+    inputs[0] = split_heads(getEngine(), inputs[0], head_axis, hk_start * group, hk_count * group);
+    inputs[1] = split_heads(getEngine(), inputs[1], head_axis, hk_start, hk_count);
+    inputs[2] = split_heads(getEngine(), inputs[2], head_axis, hk_start, hk_count);
+
+    // output [B, H, L, S] of the rank heads, the buffer may still be read by the other ranks
+    // during the previous gather
+    m_tp_cfg.communicator->wait_released(m_tp_cfg.w_rank);
+    auto dst_dims = output->getStaticDims();
+    dst_dims[1] = hk_count * group;
+    auto dst_desc = std::make_shared<CpuBlockedMemoryDesc>(output->getDesc().getPrecision(), Shape(dst_dims));
+    if (m_tp_cfg.cached_dst) {
+        m_tp_cfg.cached_dst->redefineDesc(dst_desc);
+    } else {
+        m_tp_cfg.cached_dst = std::make_shared<Memory>(getEngine(), dst_desc);
+    }
+    output = m_tp_cfg.cached_dst;
+}
+
+void ScaledDotProductAttention::execTensorParallelSync() {
+    // gather the heads of all the ranks: the heads of a batch are contiguous in [B, H, L, S] output
+    auto dst = getDstMemoryAtPort(0);
+    const auto& dims = m_tp_cfg.cached_dst->getStaticDims();
+    const auto row_size = m_tp_cfg.cached_dst->getSize() / dims[0];
+    m_tp_cfg.communicator->all_gather(m_tp_cfg.w_rank,
+                                      m_tp_cfg.cached_dst->getData(),
+                                      row_size,
+                                      dst->getData(),
+                                      dims[0],
+                                      *context->getCpuParallel());
 }
 
 void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
@@ -1935,6 +2033,7 @@ void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
 }
 
 void ScaledDotProductAttention::createPrimitive() {
+    needUpdateTensorParallelConfig();
     if (m_config.config.fuse_concat) {
         auto* desc = getSelectedPrimitiveDescriptor();
         CPU_NODE_ASSERT(desc, "has unidentified preferable primitive descriptor");
@@ -2076,6 +2175,9 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     for (size_t i = 0; i < orginSDPInputNumber; i++) {
         inputs[i] = getSrcMemoryAtPort(i);
     }
+    if (m_tp_cfg.enable_tensor_parallel) {
+        prepareTensorParallelMemory(inputs, output);
+    }
 
     PlainTensor k_scale_zp;
     PlainTensor v_scale_zp;
@@ -2104,6 +2206,9 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
                         v_scale_zp,
                         m_k_codec,
                         m_v_codec);
+    if (m_tp_cfg.enable_tensor_parallel) {
+        execTensorParallelSync();
+    }
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
@@ -8,8 +8,10 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "collectives.hpp"
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -24,6 +26,16 @@
 
 namespace ov::intel_cpu::node {
 
+// Attention heads are split between the ranks by the groups of KV heads, so every rank keeps
+// the KV cache of its own heads only. The outputs of the heads are gathered after the attention.
+// The KV cache state of a rank is exposed by query_state() with the heads of that rank only.
+struct SDPATensorParallelConfig : public TensorParallelConfig {
+    SDPATensorParallelConfig() = default;
+    explicit SDPATensorParallelConfig(TensorParallelConfig config) : TensorParallelConfig(std::move(config)) {}
+
+    MemoryPtr cached_dst = nullptr;
+};
+
 class ScaledDotProductAttention : public Node {
 public:
     ScaledDotProductAttention(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
@@ -75,6 +87,9 @@ public:
     const SDPAQuantParam& getValueQuantParam();
 
 private:
+    void needUpdateTensorParallelConfig();
+    void prepareTensorParallelMemory(std::vector<MemoryPtr>& inputs, MemoryPtr& output);
+    void execTensorParallelSync();
     void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t L1);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
@@ -117,6 +132,7 @@ private:
     SDPAQuantParam m_value_quant_param;
     ov::Extensions::Cpu::CacheCodec m_k_codec{};
     ov::Extensions::Cpu::CacheCodec m_v_codec{};
+    SDPATensorParallelConfig m_tp_cfg;
 };
 
 }  // namespace ov::intel_cpu::node
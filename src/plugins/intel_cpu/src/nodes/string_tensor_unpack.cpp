@@ -6,12 +6,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -23,7 +25,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_unpack.hpp"
-#include "openvino/reference/string_tensor_unpack.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 
 namespace ov::intel_cpu::node {
@@ -86,10 +87,22 @@ void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
 
 void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
-    ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
-                                        getDstDataAtPortAs<int32_t>(0),
-                                        getDstDataAtPortAs<int32_t>(1),
-                                        getDstDataAtPortAs<uint8_t>(2),
-                                        stringCount);
+    const auto* data = getSrcDataAtPortAs<const std::string>(0);
+    auto* begins = getDstDataAtPortAs<int32_t>(0);
+    auto* ends = getDstDataAtPortAs<int32_t>(1);
+    auto* symbols = getDstDataAtPortAs<uint8_t>(2);
+
+    // offsets are a cheap sequential prefix sum, the symbols are then copied in parallel
+    int32_t offset = 0;
+    for (size_t i = 0; i < stringCount; ++i) {
+        begins[i] = offset;
+        offset += static_cast<int32_t>(data[i].length());
+        ends[i] = offset;
+    }
+    context->getCpuParallel()->parallel_for(stringCount, [&](size_t i) {
+        if (!data[i].empty()) {
+            std::memcpy(symbols + begins[i], data[i].data(), data[i].length());
+        }
+    });
 }
 }  // namespace ov::intel_cpu::node
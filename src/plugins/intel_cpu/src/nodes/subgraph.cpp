@@ -11,6 +11,7 @@
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
+#include <string>
 
 #include "common/primitive_hashing_utils.hpp"
 #include "cpu_types.h"
@@ -181,6 +182,23 @@ struct SubgraphCodeGeneratorKey {
     uint32_t broadcasting_mask = 0;
     uint32_t constant_repacked_mask = 0;
 };
+
+// Key of the static kernels shared between the streams: the number of threads is taken into account since
+// it affects the parallel domain baked into the static kernels, and streams may have different number of threads
+struct StreamsSubgraphCodeGeneratorKey : public SubgraphCodeGeneratorKey {
+    StreamsSubgraphCodeGeneratorKey(const SubgraphCodeGeneratorKey& key, int num_threads_)
+        : SubgraphCodeGeneratorKey(key),
+          num_threads(num_threads_) {}
+
+    [[nodiscard]] size_t hash() const {
+        return dnnl::impl::hash_combine(SubgraphCodeGeneratorKey::hash(), num_threads);
+    }
+    bool operator==(const StreamsSubgraphCodeGeneratorKey& rhs) const {
+        return SubgraphCodeGeneratorKey::operator==(rhs) && num_threads == rhs.num_threads;
+    }
+
+    int num_threads = 0;
+};
 #endif
 
 struct SubgraphShapeInferResultKey {
@@ -679,7 +697,7 @@ Subgraph::DataFlowPasses Subgraph::getDataFlowPasses() {
 }
 
 Subgraph::ControlFlowPasses
-Subgraph::getControlFlowPasses() {  // NOLINT(readability-convert-member-functions-to-static)
+Subgraph::getControlFlowPasses() {
     ControlFlowPasses backend_passes;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64) || defined(OPENVINO_ARCH_RISCV64)
     using PassPosition = ov::snippets::pass::PassPosition;
@@ -712,9 +730,16 @@ Subgraph::getControlFlowPasses() {  // NOLINT(readability-convert-member-functio
 #    define SNIPPETS_REGISTER_PASS_RELATIVE_RISCV64(PASS_PLACE, TARGET_PASS, PASS, ...)
 #endif  // OPENVINO_ARCH_RISCV64
 
+#if defined(OPENVINO_ARCH_X86_64)
+    const auto& tuning_db_path = context->getConfig().snippetsBrgemmTuningDB;
+    if (!tuning_db_path.empty()) {
+        brgemm_blocking_tuner = std::make_shared<x64::BrgemmBlockingTuner>(x64::BrgemmTuningDB::get(tuning_db_path));
+    }
+#endif
     SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(Place::After,
                                            ov::snippets::lowered::pass::MarkLoops,
-                                           ov::intel_cpu::pass::BrgemmCPUBlocking);
+                                           ov::intel_cpu::pass::BrgemmCPUBlocking,
+                                           brgemm_blocking_tuner);
     SNIPPETS_REGISTER_PASS_RELATIVE_ARM64(Place::After,
                                           ov::snippets::lowered::pass::MarkLoops,
                                           ov::intel_cpu::pass::GemmCPUBlocking);
@@ -923,7 +948,24 @@ void Subgraph::prepareParams() {
         const auto code_gen_result = cache->getOrCreate(
             SubgraphCodeGeneratorKey(subgraph_attrs, getBroadcastingMask(in_shapes), key.constant_repacked_mask),
             [this, &snippet_config](const SubgraphCodeGeneratorKey& key) -> std::shared_ptr<SubgraphCodeGenerator> {
-                return std::make_shared<SubgraphCodeGenerator>(key.attrs, snippet_config, external_ptrs_idces);
+                auto generate = [this, &snippet_config](const SubgraphCodeGeneratorKey& code_gen_key) {
+                    auto code_gen = std::make_shared<SubgraphCodeGenerator>(code_gen_key.attrs,
+                                                                            snippet_config,
+                                                                            external_ptrs_idces);
+#if defined(OPENVINO_ARCH_X86_64)
+                    if (brgemm_blocking_tuner) {
+                        code_gen->set_brgemm_blocking_report(brgemm_blocking_tuner->take_report());
+                    }
+#endif
+                    return code_gen;
+                };
+                // Static kernels don't depend on the stream, so they are generated only once for all the streams
+                if (const auto& streams_cache = context->getStreamsSnippetsCodeCache()) {
+                    return streams_cache
+                        ->getOrCreate(StreamsSubgraphCodeGeneratorKey(key, parallel_get_max_threads()), generate)
+                        .first;
+                }
+                return generate(key);
             });
         return std::make_shared<SubgraphStaticExecutor>(snippet_config,
                                                         external_ptrs_idces,
@@ -1004,4 +1046,9 @@ bool Subgraph::has_domain_sensitive_ops() const {
     return subgraph_attrs->snippet->has_domain_sensitive_ops();
 }
 
+std::string Subgraph::getBrgemmBlockingReport() const {
+    // The report is taken from the executor since the code could be generated by the node of another stream
+    return execPtr ? execPtr->get_brgemm_blocking_report() : std::string{};
+}
+
 }  // namespace ov::intel_cpu::node
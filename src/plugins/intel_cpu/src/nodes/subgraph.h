@@ -10,6 +10,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,7 @@
 #    include "nodes/kernels/riscv64/cpu_isa_traits.hpp"
 #else
 #    include "cpu/x64/cpu_isa_traits.hpp"
+#    include "emitters/snippets/x64/kernel_executors/brgemm_blocking_tuner.hpp"
 #endif
 
 namespace ov::intel_cpu::node {
@@ -57,6 +59,8 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
     bool has_domain_sensitive_ops() const;
+    // Returns Brgemm blockings chosen by the tuner, empty if the tuning is disabled
+    std::string getBrgemmBlockingReport() const;
 
 protected:
     IShapeInfer::Result shapeInfer() const override;
@@ -124,6 +128,9 @@ private:
     mutable std::vector<VectorDims> in_shapes;
 
     std::shared_ptr<SubgraphBaseExecutor> execPtr = nullptr;
+#if defined(OPENVINO_ARCH_X86_64)
+    std::shared_ptr<x64::BrgemmBlockingTuner> brgemm_blocking_tuner = nullptr;
+#endif
 };
 
 }  // namespace ov::intel_cpu::node
@@ -184,6 +184,13 @@ private:
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MultiCachePtr& cache, const MemoryPtr& from, const MemoryPtr& to) {
+        if (from->getDesc().isCompatible(to->getDesc())) {
+            // the same layout: plain copy is enough and the memory objects are accessed on each execution,
+            // so the helper stays valid if the memory is reallocated with the same descriptor
+            plain_src = from;
+            plain_dst = to;
+            return;
+        }
         mem_holder_src = from->getPrimitive();
         mem_holder_dst = to->getPrimitive();
         reorder =
@@ -192,6 +199,19 @@ public:
 
     void execute(const dnnl::stream& strm, int iter) override {
         if (iter != 0) {
+            if (plain_src) {
+                const auto size = plain_src->getSize();
+                if (size == 0) {
+                    return;
+                }
+                const auto* src = plain_src->getData();
+                auto* dst = plain_dst->getData();
+                if (src != dst) {
+                    cpu_memcpy(dst, src, size);
+                }
+                return;
+            }
+
             if (hasEmptyDims(mem_holder_src) || hasEmptyDims(mem_holder_dst)) {
                 return;
             }
@@ -199,6 +219,10 @@ public:
             reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
         }
     }
+
+private:
+    MemoryPtr plain_src;
+    MemoryPtr plain_dst;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -270,7 +294,7 @@ DynamicBuffer::DynamicBuffer(MemoryPtr from_,
       elem_size(DnnlExtensionUtils::sizeOfDataType(from->getDataType())),
       cpu_parallel(parallel) {}
 
-void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
+void DynamicBuffer::execute(const Node* node, const dnnl::engine& eng, const int iter) {
     OPENVINO_ASSERT(from->getStaticDims()[map_rule.axis] == static_cast<size_t>(std::abs(map_rule.stride)),
                     "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. ",
                     std::abs(map_rule.stride),
@@ -278,11 +302,11 @@ void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
                     from->getStaticDims()[map_rule.axis]);
 
     if (iter == 0) {
-        init(eng);
+        init(node, eng);
     }
 
     // if chunk_offset_in_byte out of range of buffer holder, reallocate a larger chunk
-    if (check_buffer()) {
+    if (!direct_output && check_buffer()) {
         auto new_buffer = create_buffer(eng);
         move_buffer(new_buffer);
     }
@@ -294,7 +318,14 @@ void DynamicBuffer::reset(int max_iter_count_) {
     max_iter_count = max_iter_count_;
 }
 
-void DynamicBuffer::init(const dnnl::engine& eng) {
+void DynamicBuffer::set_exact_iter_count(int exact_iter_count_) {
+    exact_iter_count = exact_iter_count_;
+    // the states of the previous execution must not be transferred if the body isn't executed at all
+    num_execs = 0;
+    direct_output = false;
+}
+
+void DynamicBuffer::init(const Node* node, const dnnl::engine& eng) {
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
 
@@ -305,6 +336,20 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, static_cast<size_t>(1), std::multiplies<>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<>());
     chunk_unit_in_byte = abs_stride * len;
+    num_execs = 0;
+
+    direct_output = exact_iter_count > 0;
+    if (direct_output) {
+        auto out_dims = dims;
+        out_dims[map_rule.axis] = abs_stride * exact_iter_count;
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)
+                              ->cloneWithNewDims(DnnlExtensionUtils::convertToVectorDims(out_dims));
+        redefineToMemories(to, desc);
+
+        chunk_stride_in_byte = abs_stride * exact_iter_count * len;
+        chunk_offset_in_byte = stride > 0 ? 0 : (chunk_stride_in_byte - chunk_unit_in_byte);
+        return;
+    }
 
     if (!mem_holder_buffer) {  // else reuse buffer holder of last inference
         // preallocate a large chunk of memory to hold intermediate concated outputs of all iterations.
@@ -314,7 +359,6 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
     // reset chunk_offset_in_byte since the first execution
     chunk_stride_in_byte = mem_holder_buffer->getSize() / count;
     chunk_offset_in_byte = stride > 0 ? 0 : (chunk_stride_in_byte - chunk_unit_in_byte);
-    num_execs = 0;
 }
 
 bool DynamicBuffer::check_buffer() const {
@@ -385,8 +429,9 @@ void DynamicBuffer::move_data() {
     const auto src_stride = abs(map_rule.stride) * len;
     const auto dst_stride = chunk_stride_in_byte;
 
+    auto* dst = direct_output ? to.front()->getDataAs<uint8_t>() : mem_holder_buffer->getDataAs<uint8_t>();
     copy(from->getDataAs<const uint8_t>(),
-         mem_holder_buffer->getDataAs<uint8_t>() + chunk_offset_in_byte,
+         dst + chunk_offset_in_byte,
          src_stride,
          dst_stride,
          count,
@@ -403,6 +448,16 @@ void DynamicBuffer::move_data() {
 }
 
 void DynamicBuffer::transfer(const Node* node) {
+    if (direct_output) {
+        // the output is already defined and filled by the iterations
+        OPENVINO_ASSERT(num_execs == exact_iter_count,
+                        "TensorIterator (Loop) is expected to execute ",
+                        exact_iter_count,
+                        " iterations, but actual: ",
+                        num_execs);
+        return;
+    }
+
     if (mem_holder_buffer && num_execs > 0) {
         const auto axis = map_rule.axis;
         const auto stride = map_rule.stride;
@@ -432,6 +487,8 @@ void DynamicBuffer::transfer(const Node* node) {
     } else {
         VectorDims newDims = to.front()->getShape().getDims();
         nullifyUndefinedDims(newDims);
+        // nothing is concatenated
+        newDims[map_rule.axis] = 0;
 
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(newDims);
         redefineToMemories(to, desc);
@@ -596,6 +653,7 @@ void TensorIterator::createPrimitive() {
     if (loopBodyConditionOutputIdx == -1) {
         continue_cond_check = std::make_shared<staticValueCheck>(true);  // always true
     }
+    continueCondAlwaysTrue = isContinueCondAlwaysTrue();
     if (loopExecutionConditionIdx == -1) {
         initial_cond_check = std::make_shared<staticValueCheck>(true);
         lastUsedCond = (initial_cond_check->getStatus() != 0);
@@ -721,6 +779,12 @@ void TensorIterator::executeDynamicImpl(const dnnl::stream& strm) {
     bool continue_cond = initial_cond_check->getStatus() != 0;
     int max_num_iter = trip_count_check->getStatus();
 
+    // the number of iterations is known in advance, so the concatenated outputs are written in place
+    const int exact_num_iter = (continue_cond && continueCondAlwaysTrue && max_num_iter > 0) ? max_num_iter : -1;
+    for (auto& buffer : buffers) {
+        buffer->set_exact_iter_count(exact_num_iter);
+    }
+
     for (auto& mapper : first_mappers) {
         mapper.second->execute(strm, -1);
     }
@@ -740,7 +804,7 @@ void TensorIterator::executeDynamicImpl(const dnnl::stream& strm) {
         continue_cond = (continue_cond_check->getStatus() != 0);
 
         for (auto& buffer : buffers) {
-            buffer->execute(eng, i);
+            buffer->execute(this, eng, i);
         }
 
         // on the last iteration we shouldn't reshape body inputs and init back edges
@@ -801,16 +865,22 @@ void TensorIterator::prepareBackEdges() {
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
-    back_mappers.clear();
-    for (auto map_rule : backEdges) {
+    back_mappers.resize(backEdges.size());
+    for (size_t i = 0; i < backEdges.size(); i++) {
+        const auto& map_rule = backEdges[i];
         auto from_mem = output_mem[map_rule.from];
-        auto to_mems = input_mems[map_rule.to];
+        auto& to_mems = input_mems[map_rule.to];
+
+        // the loop-carried state usually keeps its shape between the iterations: the body input isn't redefined
+        // and the mapper (which copies by the memory objects in this case) is reused
+        if (back_mappers[i] && to_mems.front()->getDesc().isCompatible(from_mem->getDesc())) {
+            continue;
+        }
 
         redefineToMemories(to_mems, from_mem->getDescPtr());
 
         // first memory is enough to get common memory ptr
-        back_mappers.emplace_back(
-            std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front()));
+        back_mappers[i] = std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front());
     }
 }
 
@@ -870,6 +940,18 @@ void TensorIterator::prepareTripCount(const bool compileStage) {
     }
 }
 
+bool TensorIterator::isContinueCondAlwaysTrue() const {
+    if (loopBodyConditionOutputIdx == -1) {
+        return true;
+    }
+    // e.g. Loop with a constant true body condition, which is limited by the trip count only
+    const auto outNode = sub_graph.getOutputNodeByIndex(loopBodyConditionOutputIdx);
+    if (!outNode || !outNode->getParentEdgeAt(0)->getParent()->isConstant()) {
+        return false;
+    }
+    return asBoolCheck(outNode->getSrcMemoryAtPort(0)).getStatus() != 0;
+}
+
 /* *==============* *==============* *==============* *==============* *==============* */
 
 inline VectorDims sliced_input_dims(const MemoryPtr& mem, const int axis, const int stride) {
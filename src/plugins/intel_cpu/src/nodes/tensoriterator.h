@@ -70,7 +70,9 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * If the number of iterations is known before the loop is executed, the final output shape is known
+ * after the first iteration, so the chunks are written directly into the output memory.
  */
 class DynamicBuffer {
 public:
@@ -79,13 +81,14 @@ public:
                   const PortMap& map_rule_,
                   const std::shared_ptr<CpuParallel>& parallel);
 
-    void execute(const dnnl::engine& eng, int iter);
+    void execute(const Node* node, const dnnl::engine& eng, int iter);
     void transfer(const Node* node);
 
     void reset(int max_iter_count_);  // reset local
+    void set_exact_iter_count(int exact_iter_count_);
 
 private:
-    void init(const dnnl::engine& eng);
+    void init(const Node* node, const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
     [[nodiscard]] bool check_buffer() const;
@@ -110,6 +113,8 @@ private:
     size_t chunk_unit_in_byte = 0LU;  // the amount of bytes copied per each count per each execution (iteration)
     int num_execs = 0LU;              // number of executions happened
     int max_iter_count = -1;          // estimated maximum iter count
+    int exact_iter_count = -1;        // iter count of the current execution if it's known in advance
+    bool direct_output = false;       // chunks are written directly into "to" memory
 
     /* invariable states */
     MemoryPtr from;
@@ -164,6 +169,7 @@ private:
     void prepareContinueCond();
     void prepareInitialCond(bool compileStage);
     void prepareTripCount(bool compileStage);
+    bool isContinueCondAlwaysTrue() const;
 
     /* Dynamic support */
     void reshapeSubgraphInput();
@@ -213,6 +219,7 @@ private:
 
     int lastUsedTripCount = -1;
     bool lastUsedCond = false;
+    bool continueCondAlwaysTrue = false;
 
     const std::shared_ptr<ov::Node> ngraphOp;
 };
@@ -47,6 +47,7 @@
 #include "nodes/grn.h"
 #include "nodes/identity.hpp"
 #include "nodes/if.h"
+#include "nodes/image_preprocess.h"
 #include "nodes/input.h"
 #include "nodes/interpolate.h"
 #include "nodes/inverse.hpp"
@@ -58,6 +59,7 @@
 #include "nodes/matmul.h"
 #include "nodes/matrix_nms.h"
 #include "nodes/memory.hpp"
+#include "nodes/moe.h"
 #include "nodes/multiclass_nms.hpp"
 #include "nodes/multinomial.hpp"
 #include "nodes/mvn.h"
@@ -221,6 +223,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(Ngram, Type::Ngram);
     INTEL_CPU_NODE(RoPE, Type::RoPE);
     INTEL_CPU_NODE(CausalMaskPreprocess, Type::CausalMaskPreprocess);
+    INTEL_CPU_NODE(ImagePreprocess, Type::ImagePreprocess);
     INTEL_CPU_NODE(Identity, Type::Identity);
     INTEL_CPU_NODE(Interpolate, Type::Interpolate);
     INTEL_CPU_NODE(Inverse, Type::Inverse);
@@ -247,6 +250,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(SegmentMax, Type::SegmentMax);
     INTEL_CPU_NODE(LoRA, Type::LoRA);
     INTEL_CPU_NODE(GatherMatmul, Type::GatherMatmul);
+    INTEL_CPU_NODE(MOE, Type::MOE);
     INTEL_CPU_NODE(GatedDeltaNet, Type::GatedDeltaNet);
     INTEL_CPU_NODE(PagedGatedDeltaNet, Type::PagedGatedDeltaNet);
     INTEL_CPU_NODE(PagedCausalConv1D, Type::PagedCausalConv1D);
@@ -477,6 +477,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
     if (name == ov::hint::execution_mode) {
         return engConfig.executionMode;
     }
+    if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
+    }
     if (name == ov::internal::compiled_model_runtime_properties.name()) {
         auto model_runtime_properties = ov::Any(m_compiled_model_runtime_properties);
         return decltype(ov::internal::compiled_model_runtime_properties)::value_type(
@@ -579,6 +582,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::hint::scheduling_core_type.name()),
                                                    RW_property(ov::hint::model_distribution_policy.name()),
                                                    RW_property(ov::hint::enable_hyper_threading.name()),
+                                                   RW_property(ov::hint::model_priority.name()),
                                                    RW_property(ov::device::id.name()),
                                                    RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                    RW_property(ov::log::level.name()),
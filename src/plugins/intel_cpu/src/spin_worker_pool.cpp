@@ -0,0 +1,255 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "spin_worker_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
+#    include <immintrin.h>
+#endif
+#if defined(__linux__)
+#    include <sched.h>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+thread_local bool t_in_region = false;
+// whether the job executed by the calling thread belongs to a region run sequentially, its barriers are no-ops
+thread_local bool t_sequential_region = false;
+
+class SequentialRegionGuard {
+public:
+    SequentialRegionGuard(bool sequential) : m_saved(t_sequential_region) {
+        t_sequential_region = sequential;
+    }
+    ~SequentialRegionGuard() {
+        t_sequential_region = m_saved;
+    }
+
+    SequentialRegionGuard(const SequentialRegionGuard&) = delete;
+    SequentialRegionGuard& operator=(const SequentialRegionGuard&) = delete;
+
+private:
+    bool m_saved;
+};
+
+// The region state word keeps the region counter in the high bits and the number of the participating
+// threads in the low ones, so an idle worker never mixes up the participants of two regions
+constexpr uint64_t active_bits = 16;
+constexpr uint64_t active_mask = (uint64_t{1} << active_bits) - 1;
+
+uint64_t next_state(uint64_t state, int active) {
+    return (((state >> active_bits) + 1) << active_bits) | static_cast<uint64_t>(active);
+}
+
+inline void cpu_relax() {
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
+    _mm_pause();
+#endif
+}
+
+template <typename Pred>
+void spin_wait(const Pred& pred) {
+    // The participants of a region finish almost simultaneously, so busy waiting is cheaper than blocking.
+    // Yield the core if the wait takes too long to not starve the other streams on oversubscribed systems.
+    constexpr size_t spins_before_yield = 1024;
+    size_t spins = 0;
+    while (!pred()) {
+        if (++spins < spins_before_yield) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+std::vector<int> get_affinity_cpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &mask)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+void pin_current_thread(int cpu) {
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+    sched_setaffinity(0, sizeof(mask), &mask);
+#else
+    (void)cpu;
+#endif
+}
+}  // namespace
+
+SpinWorkerPool::SpinWorkerPool(int num_threads, uint32_t spin_time_us, bool pin_threads)
+    : m_spin_time_us(spin_time_us) {
+    OPENVINO_ASSERT(num_threads > 0 && static_cast<uint64_t>(num_threads) <= active_mask,
+                    "SpinWorkerPool got unsupported number of threads: ",
+                    num_threads);
+    // the workers take the cores of the creating (stream) thread mask after the one of the calling thread,
+    // pinning is skipped if the mask does not have a core for every thread
+    std::vector<int> cpus = pin_threads ? get_affinity_cpus() : std::vector<int>{};
+    if (cpus.size() < static_cast<size_t>(num_threads)) {
+        cpus.clear();
+    }
+
+    m_workers.reserve(num_threads - 1);
+    for (int idx = 1; idx < num_threads; idx++) {
+        m_workers.emplace_back(&SpinWorkerPool::worker, this, idx, cpus);
+    }
+}
+
+SpinWorkerPool::~SpinWorkerPool() {
+    m_stop.store(true, std::memory_order_seq_cst);
+    m_state.store(next_state(m_state.load(std::memory_order_relaxed), 0), std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(m_park_mutex);
+    }
+    m_park_cv.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+bool SpinWorkerPool::in_region() {
+    return t_in_region;
+}
+
+void SpinWorkerPool::run_impl(int nthr, Invoke invoke, const void* ctx) {
+    if (nthr <= 0) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_run_mutex, std::defer_lock);
+    if (nthr == 1 || m_workers.empty() || t_in_region || !lock.try_lock()) {
+        // m_active describes the region of another thread (or of the enclosing region), if any
+        SequentialRegionGuard sequential(true);
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            invoke(ctx, ithr, nthr);
+        }
+        return;
+    }
+
+    m_invoke = invoke;
+    m_ctx = ctx;
+    m_jobs = nthr;
+    m_active = std::min(nthr, get_num_threads());
+    m_exception = nullptr;
+    m_failed.store(false, std::memory_order_relaxed);
+    m_pending.store(m_active - 1, std::memory_order_relaxed);
+
+    m_state.store(next_state(m_state.load(std::memory_order_relaxed), m_active), std::memory_order_seq_cst);
+    if (m_parked.load(std::memory_order_seq_cst) > 0) {
+        {
+            std::lock_guard<std::mutex> park_lock(m_park_mutex);
+        }
+        m_park_cv.notify_all();
+    }
+
+    run_jobs(0);
+
+    spin_wait([&]() {
+        return m_pending.load(std::memory_order_acquire) == 0;
+    });
+
+    if (m_exception) {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+void SpinWorkerPool::run_jobs(int ithr) noexcept {
+    t_in_region = true;
+    SequentialRegionGuard sequential(false);
+    try {
+        for (int job = ithr; job < m_jobs; job += m_active) {
+            m_invoke(m_ctx, job, m_jobs);
+        }
+    } catch (...) {
+        if (!m_failed.exchange(true, std::memory_order_acq_rel)) {
+            m_exception = std::current_exception();
+        }
+    }
+    t_in_region = false;
+}
+
+void SpinWorkerPool::barrier() {
+    // the jobs of a sequential region run one after another, there is nobody to wait for
+    if (t_sequential_region || m_active <= 1) {
+        return;
+    }
+    // the epoch cannot change before the calling thread arrives
+    const auto epoch = m_barrier_epoch.load(std::memory_order_acquire);
+    if (m_barrier_count.fetch_add(1, std::memory_order_acq_rel) == m_active - 1) {
+        m_barrier_count.store(0, std::memory_order_relaxed);
+        m_barrier_epoch.fetch_add(1, std::memory_order_release);
+    } else {
+        spin_wait([&]() {
+            return m_barrier_epoch.load(std::memory_order_acquire) != epoch;
+        });
+    }
+}
+
+void SpinWorkerPool::wait_region(uint64_t seen) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(m_spin_time_us);
+    size_t spins = 0;
+    while (m_state.load(std::memory_order_acquire) == seen) {
+        cpu_relax();
+        // the clock is checked rarely to keep the reaction to a new region fast
+        if ((++spins & 63U) != 0 || std::chrono::steady_clock::now() < deadline) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_park_mutex);
+        m_parked.fetch_add(1, std::memory_order_seq_cst);
+        m_park_cv.wait(lock, [&]() {
+            return m_state.load(std::memory_order_seq_cst) != seen;
+        });
+        m_parked.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+}
+
+void SpinWorkerPool::worker(int idx, const std::vector<int>& cpus) {
+    if (!cpus.empty()) {
+        pin_current_thread(cpus[idx]);
+    }
+
+    uint64_t seen = 0;
+    while (true) {
+        wait_region(seen);
+        if (m_stop.load(std::memory_order_acquire)) {
+            return;
+        }
+        seen = m_state.load(std::memory_order_acquire);
+        // the region parameters are stable only for its participants, the caller waits for them
+        if (static_cast<uint64_t>(idx) < (seen & active_mask)) {
+            run_jobs(idx);
+            m_pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+}
+
+}  // namespace ov::intel_cpu
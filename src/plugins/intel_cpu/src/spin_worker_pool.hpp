@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Persistent pool of worker threads for latency bound parallel regions.
+ * Workers busy wait for the next region during the configured spin time and park afterwards,
+ * so back-to-back small regions (e.g. LLM decode) do not pay the wake-up and task spawn cost.
+ * The work is statically partitioned: the job ithr of a region is executed by the thread ithr % nthr,
+ * the calling thread works as the thread 0.
+ * A pool serves one stream: a region started from inside another region, or while another thread
+ * runs a region, is executed sequentially by the calling thread.
+ */
+class SpinWorkerPool {
+public:
+    /**
+     * @param num_threads number of threads executing a region, including the calling thread
+     * @param spin_time_us time a worker busy waits for the next region before parking
+     * @param pin_threads pin the workers to the cores of the affinity mask of the creating thread
+     */
+    SpinWorkerPool(int num_threads, uint32_t spin_time_us, bool pin_threads);
+    ~SpinWorkerPool();
+
+    SpinWorkerPool(const SpinWorkerPool&) = delete;
+    SpinWorkerPool& operator=(const SpinWorkerPool&) = delete;
+
+    [[nodiscard]] int get_num_threads() const {
+        return static_cast<int>(m_workers.size()) + 1;
+    }
+
+    /**
+     * @brief Runs func(ithr, nthr) for every ithr in [0, nthr) and waits for completion.
+     * The first exception thrown by the jobs is rethrown to the caller.
+     */
+    template <typename F>
+    void run(int nthr, const F& func) {
+        run_impl(
+            nthr,
+            [](const void* ctx, int ithr, int nthr) {
+                (*static_cast<const F*>(ctx))(ithr, nthr);
+            },
+            &func);
+    }
+
+    /**
+     * @brief Blocks until all the threads of the current region reach the barrier.
+     * Must be called by every job of a region which has no more jobs than threads.
+     * Does nothing in a region executed sequentially (nested or started while the pool is busy).
+     */
+    void barrier();
+
+    /**
+     * @brief Whether the calling thread executes a job of a region of any pool
+     */
+    [[nodiscard]] static bool in_region();
+
+private:
+    using Invoke = void (*)(const void*, int, int);
+
+    void run_impl(int nthr, Invoke invoke, const void* ctx);
+    void run_jobs(int ithr) noexcept;
+    void worker(int idx, const std::vector<int>& cpus);
+    void wait_region(uint64_t seen);
+
+    const uint32_t m_spin_time_us;
+    std::vector<std::thread> m_workers;
+    std::mutex m_run_mutex;
+
+    // current region
+    Invoke m_invoke = nullptr;
+    const void* m_ctx = nullptr;
+    int m_jobs = 0;
+    int m_active = 0;
+    std::exception_ptr m_exception;
+    std::atomic<bool> m_failed{false};
+
+    alignas(64) std::atomic<uint64_t> m_state{0};
+    alignas(64) std::atomic<int> m_pending{0};
+    alignas(64) std::atomic<int> m_barrier_count{0};
+    alignas(64) std::atomic<uint64_t> m_barrier_epoch{0};
+
+    std::mutex m_park_mutex;
+    std::condition_variable m_park_cv;
+    std::atomic<int> m_parked{0};
+    std::atomic<bool> m_stop{false};
+};
+
+using SpinWorkerPoolPtr = std::shared_ptr<SpinWorkerPool>;
+
+}  // namespace ov::intel_cpu
@@ -11,6 +11,7 @@
 #include "cpu_parallel.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "spin_worker_pool.hpp"
 
 namespace ov::intel_cpu {
 
@@ -28,7 +29,8 @@ public:
         return m_cpu_parallel.get_num_threads();
     }
     [[nodiscard]] bool get_in_parallel() const override {
-        return false;
+        // nested regions of the worker pool are executed sequentially
+        return m_cpu_parallel.get_worker_pool() && SpinWorkerPool::in_region();
     }
     [[nodiscard]] uint64_t get_flags() const override {
         return 0;
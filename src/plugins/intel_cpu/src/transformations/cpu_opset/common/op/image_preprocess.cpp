@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "image_preprocess.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::ImagePreprocessNode::ImagePreprocessNode(const OutputVector& args, Config cfg)
+    : Op(args),
+      m_config(std::move(cfg)) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::ImagePreprocessNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ImagePreprocessNode>(new_args, m_config);
+}
+
+void ov::intel_cpu::ImagePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_validate_and_infer_types);
+    // inputs:
+    //   single plane: 0: NV12 image u8[N, H * 3 / 2, W, 1]
+    //   two planes:   0: Y plane    u8[N, H, W, 1]
+    //                 1: UV plane   u8[N, H / 2, W / 2, 2]
+    // outputs:
+    //   0: f32[N, OH, OW, 3] or f32[N, 3, OH, OW] when planar_output is set
+    const size_t expected_inputs = m_config.single_plane ? 1 : 2;
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == expected_inputs,
+                          "expects ",
+                          expected_inputs,
+                          " inputs, got ",
+                          get_input_size());
+    for (size_t i = 0; i < get_input_size(); i++) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == ov::element::u8,
+                              "input ",
+                              i,
+                              " must be u8");
+        NODE_VALIDATION_CHECK(this, get_input_partial_shape(i).rank().compatible(4), "input ", i, " must be 4D");
+    }
+    NODE_VALIDATION_CHECK(this,
+                          m_config.output_height > 0 && m_config.output_width > 0,
+                          "output size must be positive");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.mean.size() == 3 && m_config.scale.size() == 3,
+                          "mean and scale must have 3 values");
+
+    const auto& in_shape = get_input_partial_shape(0);
+    const auto batch = in_shape.rank().is_static() ? in_shape[0] : Dimension::dynamic();
+    const Dimension oh(m_config.output_height);
+    const Dimension ow(m_config.output_width);
+    if (m_config.planar_output) {
+        set_output_type(0, ov::element::f32, {batch, 3, oh, ow});
+    } else {
+        set_output_type(0, ov::element::f32, {batch, oh, ow, 3});
+    }
+}
+
+bool ov::intel_cpu::ImagePreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("single_plane", m_config.single_plane);
+    visitor.on_attribute("bgr", m_config.bgr);
+    visitor.on_attribute("round_color", m_config.round_color);
+    visitor.on_attribute("planar_output", m_config.planar_output);
+    visitor.on_attribute("output_height", m_config.output_height);
+    visitor.on_attribute("output_width", m_config.output_width);
+    visitor.on_attribute("mean", m_config.mean);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.finish_structure();
+    return true;
+}
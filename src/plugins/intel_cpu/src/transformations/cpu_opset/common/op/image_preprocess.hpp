@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fused image preprocessing produced from PrePostProcessor-style chains:
+ * NV12 -> RGB/BGR -> Convert(f32) -> [bilinear resize] -> [(x - mean) * scale] -> [NHWC->NCHW].
+ * Inputs are the u8 Y and UV planes (or a single NV12 plane), the output is f32.
+ */
+class ImagePreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("ImagePreprocess", "cpu_plugin_opset");
+
+    ImagePreprocessNode() = default;
+
+    struct Config {
+        bool single_plane = false;
+        bool bgr = false;
+        // color conversion result is rounded to u8 before the float part of the pipeline
+        bool round_color = false;
+        // output is NCHW instead of NHWC
+        bool planar_output = false;
+        int64_t output_height = 0;
+        int64_t output_width = 0;
+        // per channel values, applied as (x - mean[c]) * scale[c]
+        std::vector<float> mean;
+        std::vector<float> scale;
+    };
+
+    ImagePreprocessNode(const OutputVector& args, Config cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,205 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov {
+
+namespace {
+
+// returns the only consumer of the output or nullptr
+std::shared_ptr<Node> single_consumer(const Output<Node>& output) {
+    const auto consumers = output.get_target_inputs();
+    if (consumers.size() != 1) {
+        return nullptr;
+    }
+    return consumers.begin()->get_node()->shared_from_this();
+}
+
+// second input of the eltwise must be a scalar or a per channel (last axis of NHWC) constant
+bool get_channel_values(const std::shared_ptr<Node>& eltwise, std::vector<float>& values) {
+    const auto constant = as_type_ptr<op::v0::Constant>(eltwise->get_input_node_shared_ptr(1));
+    if (!constant || eltwise->get_output_partial_shape(0) != eltwise->get_input_partial_shape(0)) {
+        return false;
+    }
+    const auto& shape = constant->get_shape();
+    const auto size = shape_size(shape);
+    if (shape.size() > 4 || (size != 1 && size != 3) || (size == 3 && shape.back() != 3)) {
+        return false;
+    }
+    values = constant->cast_vector<float>();
+    if (size == 1) {
+        values.assign(3, values[0]);
+    }
+    return true;
+}
+
+bool is_fusable_resize(const std::shared_ptr<Node>& node) {
+    const auto interp = as_type_ptr<op::util::InterpolateBase>(node);
+    if (!interp || !is_type_any_of<op::v4::Interpolate, op::v11::Interpolate>(node)) {
+        return false;
+    }
+    using Base = op::util::InterpolateBase;
+    const auto& attrs = interp->get_attrs();
+    const auto is_zero = [](size_t v) {
+        return v == 0;
+    };
+    if ((attrs.mode != Base::InterpolateMode::LINEAR && attrs.mode != Base::InterpolateMode::LINEAR_ONNX) ||
+        attrs.shape_calculation_mode != Base::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != Base::CoordinateTransformMode::HALF_PIXEL || attrs.antialias ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero)) {
+        return false;
+    }
+    const auto& in_shape = node->get_input_partial_shape(0);
+    const auto& out_shape = node->get_output_partial_shape(0);
+    // only H and W of NHWC may be resized
+    return in_shape.is_static() && out_shape.is_static() && in_shape[0] == out_shape[0] &&
+           in_shape[3] == out_shape[3];
+}
+
+}  // namespace
+
+intel_cpu::ImagePreprocessFusion::ImagePreprocessFusion() {
+    MATCHER_SCOPE(ImagePreprocessFusion);
+
+    auto color_m = pass::pattern::wrap_type<op::v8::NV12toRGB, op::v8::NV12toBGR>();
+
+    matcher_pass_callback callback = [=](pass::pattern::Matcher& m) {
+        const auto color = m.get_match_root();
+        const auto& color_shape = color->get_output_partial_shape(0);
+        if (transformation_callback(color) || color_shape.is_dynamic()) {
+            return false;
+        }
+
+        ImagePreprocessNode::Config config;
+        config.single_plane = color->get_input_size() == 1;
+        config.bgr = is_type<op::v8::NV12toBGR>(color);
+
+        // the planes are either consumed as u8 directly or through a Convert to f32
+        OutputVector planes;
+        NodeVector fused{color};
+        bool converted_planes = false;
+        for (const auto& input : color->input_values()) {
+            if (input.get_element_type() == element::f32) {
+                const auto convert = as_type_ptr<op::v0::Convert>(input.get_node_shared_ptr());
+                if (!convert || convert->get_input_element_type(0) != element::u8 ||
+                    convert->get_output_target_inputs(0).size() != 1) {
+                    return false;
+                }
+                planes.push_back(convert->input_value(0));
+                fused.push_back(convert);
+                converted_planes = true;
+            } else if (input.get_element_type() == element::u8) {
+                planes.push_back(input);
+            } else {
+                return false;
+            }
+            if (planes.back().get_partial_shape().is_dynamic()) {
+                return false;
+            }
+        }
+        if (converted_planes && color->get_output_element_type(0) != element::f32) {
+            return false;
+        }
+
+        Output<Node> tail = color->output(0);
+        auto next = single_consumer(tail);
+
+        // u8 color conversion output is rounded, the rest of the pipeline must be f32
+        config.round_color = !converted_planes;
+        if (config.round_color) {
+            if (!is_type<op::v0::Convert>(next) || next->get_output_element_type(0) != element::f32) {
+                return false;
+            }
+            fused.push_back(next);
+            tail = next->output(0);
+            next = single_consumer(tail);
+        }
+        // a bare color conversion is handled well enough by the ColorConvert node
+        const auto fused_color_ops = fused.size();
+
+        config.output_height = static_cast<int64_t>(color_shape[1].get_length());
+        config.output_width = static_cast<int64_t>(color_shape[2].get_length());
+        if (next && is_fusable_resize(next) && next->input_value(0) == tail) {
+            const auto& out_shape = next->get_output_shape(0);
+            config.output_height = static_cast<int64_t>(out_shape[1]);
+            config.output_width = static_cast<int64_t>(out_shape[2]);
+            fused.push_back(next);
+            tail = next->output(0);
+            next = single_consumer(tail);
+        }
+
+        config.mean.assign(3, 0.F);
+        config.scale.assign(3, 1.F);
+        if (is_type<op::v1::Subtract>(next) && next->input_value(0) == tail && get_channel_values(next, config.mean)) {
+            fused.push_back(next);
+            tail = next->output(0);
+            next = single_consumer(tail);
+        }
+        if (is_type_any_of<op::v1::Divide, op::v1::Multiply>(next) && next->input_value(0) == tail &&
+            get_channel_values(next, config.scale)) {
+            if (is_type<op::v1::Divide>(next)) {
+                for (auto& v : config.scale) {
+                    v = 1.F / v;
+                }
+            }
+            fused.push_back(next);
+            tail = next->output(0);
+            next = single_consumer(tail);
+        }
+
+        if (is_type<op::v1::Transpose>(next) && next->input_value(0) == tail) {
+            const auto order = as_type_ptr<op::v0::Constant>(next->get_input_node_shared_ptr(1));
+            if (order && order->cast_vector<int64_t>() == std::vector<int64_t>{0, 3, 1, 2}) {
+                config.planar_output = true;
+                fused.push_back(next);
+                tail = next->output(0);
+            }
+        }
+
+        if (fused.size() == fused_color_ops) {
+            return false;
+        }
+
+        auto preprocess = std::make_shared<ImagePreprocessNode>(planes, config);
+        preprocess->set_friendly_name(tail.get_node()->get_friendly_name());
+        copy_runtime_info(fused, preprocess);
+        replace_node(tail.get_node_shared_ptr(), preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<pass::pattern::Matcher>(color_m, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov
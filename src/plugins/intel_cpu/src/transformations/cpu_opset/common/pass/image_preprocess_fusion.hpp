@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+// Fuses the chain generated by PrePostProcessor for NV12 image inputs into a single ImagePreprocess node:
+// [Convert(f32)] -> NV12toRGB/BGR -> [Convert(f32)] -> [Interpolate(linear)] -> [Subtract] -> [Divide/Multiply]
+//     -> [Transpose(0,3,1,2)]
+
+namespace ov::intel_cpu {
+
+class ImagePreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ImagePreprocessFusion");
+    ImagePreprocessFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -18,6 +18,7 @@
 #include "config.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/gathermatmul.h"
+#include "nodes/moe.h"
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -26,6 +27,7 @@
 #include "openvino/pass/validate.hpp"
 #include "ov_ops/fully_connected.hpp"
 #include "transformations/common_optimizations/convert_tiled_moe_block_to_gather_matmuls.hpp"
+#include "transformations/common_optimizations/moe_op_fusion.hpp"
 #include "transformations/common_optimizations/nop_elimination.hpp"
 #include "transformations/common_optimizations/reshape_sequence_fusion.hpp"
 #include "transformations/common_optimizations/transpose_to_reshape.hpp"
@@ -57,6 +59,16 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ov::Model>& model, const C
             size_t G) {
             return ov::intel_cpu::node::GatherMatmul::isSupportedCompressedOperation(gather_matmul, IC, OC, G, config);
         });
+    // Collapse the gate/up/down GatherMatmul block into a single MOE node, unless the node can't execute it
+    if (config.moeOpFusion) {
+        CPU_REGISTER_PASS_X64(manager, ov::pass::Convert3GatherMatmulMoeBlockToMoeOp);
+        CPU_SET_CALLBACK_X64(
+            manager,
+            [](const std::shared_ptr<const ov::Node>& node) -> bool {
+                return ov::intel_cpu::node::MOE::isUnsupportedMoeBlock(node);
+            },
+            ov::pass::Convert3GatherMatmulMoeBlockToMoeOp);
+    }
 
     CPU_REGISTER_PASS_COMMON(manager, ConvertMatMulToFC);
     CPU_REGISTER_PASS_COMMON(manager, FullyConnectedBiasFusion);
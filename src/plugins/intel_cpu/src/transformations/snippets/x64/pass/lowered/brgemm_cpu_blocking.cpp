@@ -4,6 +4,7 @@
 
 #include "brgemm_cpu_blocking.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iterator>
@@ -12,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "emitters/snippets/x64/kernel_executors/brgemm_blocking_tuner.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -37,6 +39,9 @@ using namespace ov::intel_cpu::brgemm_utils;
 using namespace ov::snippets::lowered;
 using namespace ov::snippets::utils;
 
+BrgemmCPUBlocking::BrgemmCPUBlocking(std::shared_ptr<ov::intel_cpu::x64::BrgemmBlockingTuner> tuner)
+    : m_tuner(std::move(tuner)) {}
+
 bool BrgemmCPUBlocking::DummyPass::run([[maybe_unused]] LinearIR& linear_ir,
                                        [[maybe_unused]] LinearIR::constExprIt begin,
                                        [[maybe_unused]] LinearIR::constExprIt end) {
@@ -135,9 +140,78 @@ std::tuple<size_t, size_t, size_t> BrgemmCPUBlocking::get_blocking_params(
         n_blk = get_full_dim_value();
         k_blk = get_full_dim_value();
     }
+
+    const bool is_static = !is_dynamic_value(m) && !is_dynamic_value(n) && !is_dynamic_value(k);
+    // Note: AMX kernels require tiles configuration which depends on the blocking, so they are not tuned
+    if (m_tuner && is_static && !brgemm_config.is_amx()) {
+        // Full dim values are replaced with the corresponding dimensions to benchmark the real loops
+        auto to_block = [](size_t dim, size_t blk) {
+            return is_full_dim_value(blk) ? dim : blk;
+        };
+        const ov::intel_cpu::x64::BrgemmBlocking default_blocking{to_block(m, m_blk),
+                                                                 to_block(n, n_blk),
+                                                                 to_block(k, k_blk)};
+        const ov::intel_cpu::x64::BrgemmTuningDB::Key key{m,
+                                                          n,
+                                                          k,
+                                                          brgemm->get_input_element_type(0),
+                                                          brgemm->get_input_element_type(1),
+                                                          brgemm_config.isa(),
+                                                          brgemm_config.with_wei_repacking(),
+                                                          brgemm_config.transposed_b()};
+        const auto candidates = get_tuning_candidates(m,
+                                                      n,
+                                                      k,
+                                                      default_blocking,
+                                                      is_kn_blocking_supported(brgemm->get_input_element_type(1)) &&
+                                                          !brgemm_config.are_wei_blocked());
+        const auto tuned = m_tuner->tune(key, candidates);
+        m_blk = get_corrected_blk_size_by_dim(m, tuned.m_blk);
+        // N and K blocks are changed only if the corresponding blocking is supported
+        if (!is_full_dim_value(n_blk) && !brgemm_config.are_wei_blocked()) {
+            n_blk = get_corrected_blk_size_by_dim(n, tuned.n_blk);
+        }
+        if (!is_full_dim_value(k_blk)) {
+            k_blk = get_corrected_blk_size_by_dim(k, tuned.k_blk);
+        }
+    }
     return std::make_tuple(m_blk, n_blk, k_blk);
 }
 
+std::vector<ov::intel_cpu::x64::BrgemmBlocking> BrgemmCPUBlocking::get_tuning_candidates(
+    size_t m,
+    size_t n,
+    size_t k,
+    const ov::intel_cpu::x64::BrgemmBlocking& default_blocking,
+    bool is_kn_blocking_supported) {
+    std::vector<ov::intel_cpu::x64::BrgemmBlocking> candidates{default_blocking};
+    auto add_candidate = [&](size_t m_blk, size_t n_blk, size_t k_blk) {
+        const ov::intel_cpu::x64::BrgemmBlocking candidate{std::min(m_blk, m), std::min(n_blk, n), std::min(k_blk, k)};
+        if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end()) {
+            candidates.push_back(candidate);
+        }
+    };
+
+    const std::vector<size_t> m_blocks{16, 32, 64, 128};
+    for (const auto m_blk : m_blocks) {
+        add_candidate(m_blk, default_blocking.n_blk, default_blocking.k_blk);
+    }
+    // K blocking is always allowed with N blocking (see get_blocking_params), so it's enough to tune N separately
+    if (is_kn_blocking_supported) {
+        const std::vector<size_t> n_blocks{32, 64, 128};
+        for (const auto n_blk : n_blocks) {
+            add_candidate(default_blocking.m_blk, n_blk, default_blocking.k_blk);
+        }
+    }
+    if (default_blocking.k_blk < k) {
+        const std::vector<size_t> k_blocks{256, 512, 1024, k};
+        for (const auto k_blk : k_blocks) {
+            add_candidate(default_blocking.m_blk, default_blocking.n_blk, k_blk);
+        }
+    }
+    return candidates;
+}
+
 SpecificIterationHandlers BrgemmCPUBlocking::get_k_loop_handlers(size_t work_amount, size_t block_size) const {
     SpecificIterationHandlers handlers =
         ov::snippets::lowered::pass::BrgemmBlockingBase::get_k_loop_handlers(work_amount, block_size);
@@ -7,7 +7,9 @@
 #include <cstddef>
 #include <memory>
 #include <tuple>
+#include <vector>
 
+#include "emitters/snippets/x64/kernel_executors/brgemm_blocking_tuner.hpp"
 #include "openvino/core/rtti.hpp"
 #include "snippets/lowered/expression.hpp"
 #include "snippets/lowered/linear_ir.hpp"
@@ -27,6 +29,13 @@ class BrgemmCPUBlocking : public ov::snippets::lowered::pass::BrgemmBlocking<Brg
 public:
     OPENVINO_RTTI("BrgemmCPUBlocking", "", BrgemmBlocking)
 
+    BrgemmCPUBlocking() = default;
+    /**
+     * @param tuner If set, blocking params of Brgemms with static shapes are selected by the tuner
+     *              from the candidates derived from the default heuristic
+     */
+    explicit BrgemmCPUBlocking(std::shared_ptr<ov::intel_cpu::x64::BrgemmBlockingTuner> tuner);
+
     /**
      * @interface DummyPass
      * @brief The empty pass which is used to force insertion of first specific iteration of loop by K dimension
@@ -85,6 +94,18 @@ private:
                              size_t m_block,
                              size_t n_block,
                              size_t k_block) override;
+
+    /**
+     * @brief Returns the blockings to be benchmarked by the tuner. The default blocking is always the first one.
+     */
+    static std::vector<ov::intel_cpu::x64::BrgemmBlocking> get_tuning_candidates(
+        size_t m,
+        size_t n,
+        size_t k,
+        const ov::intel_cpu::x64::BrgemmBlocking& default_blocking,
+        bool is_kn_blocking_supported);
+
+    std::shared_ptr<ov::intel_cpu::x64::BrgemmBlockingTuner> m_tuner = nullptr;
 };
 
 }  // namespace ov::intel_cpu::pass
@@ -142,6 +142,7 @@
 #include "transformations/low_precision/mark_dequantization_subgraph.hpp"
 
 // CPU specific transformations
+#include "transformations/cpu_opset/common/pass/image_preprocess_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
@@ -583,6 +584,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::AUGRUCellFusion);
     CPU_REGISTER_PASS_COMMON(manager, SDPASubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::GatedDeltaNetFusion);
+    // Must run before CommonOptimizations decomposes and reorders the preprocessing eltwise and transpose ops
+    CPU_REGISTER_PASS_COMMON(manager, ImagePreprocessFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::CommonOptimizations);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstPrecision, decompression_precisions, false, true);
     CPU_SET_CALLBACK_COMMON(
@@ -901,7 +904,12 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
        and finally do CF for those constant paths that are not inputs to MatMul node */
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    if (config.concurrentConstantFolding) {
+        // the weights of different layers are folded concurrently
+        CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConcurrentConstantFolding);
+    } else {
+        CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    }
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
@@ -1273,10 +1281,18 @@ void Transformations::MainSnippets() {
     bool is_dynamic_mha_token_enabled = config.snippetsCacheCapacity != 0;
     // [122706] Some 3D MHA Patterns have perf regressions when Transpose op is tokenized
     std::set<size_t> mha_supported_transpose_ranks = {4};
+    // Elementwise part of RoPE which is not fused into RoPE node can be computed inside MHA Subgraph instead of
+    // separate Eltwise nodes. It's disabled by default until the performance impact is measured on real models.
+#if defined(OPENVINO_ARCH_X86_64)
+    const bool is_rope_mha_token_enabled = config.snippetsMHARoPETokenization;
+#else
+    const bool is_rope_mha_token_enabled = false;
+#endif
     TokenizeMHASnippets::Config mha_config(tokenization_config,
                                            mha_token_enable_transpose_on_output,
                                            is_dynamic_mha_token_enabled,
-                                           mha_supported_transpose_ranks);
+                                           mha_supported_transpose_ranks,
+                                           is_rope_mha_token_enabled);
 #if defined(OPENVINO_ARCH_X86_64)
     auto supported_as_postop = [this](const std::shared_ptr<const ov::op::v0::MatMul>& matmul,
                                       const std::shared_ptr<const ov::Node>& node) {
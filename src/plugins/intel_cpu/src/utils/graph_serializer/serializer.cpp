@@ -12,6 +12,7 @@
 #include <ostream>
 #include <string>
 
+#include "openvino/core/any.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
@@ -156,6 +157,14 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
     run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
 }
 
+void ModelSerializer::serialize(const std::shared_ptr<ov::Model>& model, const ov::AnyMap& rt_info) {
+    auto model_copy = model->clone();
+    for (const auto& [name, value] : rt_info) {
+        model_copy->set_rt_info(value, name);
+    }
+    run_on_model(model_copy);
+}
+
 bool ModelSerializer::use_absolute_offset() {
     return false;
 }
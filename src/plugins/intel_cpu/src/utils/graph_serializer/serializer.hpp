@@ -8,6 +8,7 @@
 #include <pugixml.hpp>
 #include <string>
 
+#include "openvino/core/any.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
 
@@ -21,6 +22,12 @@ public:
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Serializes the model with additional model rt_info entries
+     * The entries are set on the serialized copy, the model itself is not modified
+     */
+    void serialize(const std::shared_ptr<ov::Model>& model, const ov::AnyMap& rt_info);
+
 private:
     bool use_absolute_offset() override;
 
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "common_test_utils/subgraph_builders/matmul_bias.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+// node name -> "executorTuning" attribute of the execution graph
+std::map<std::string, std::string> getTuningInfo(const ov::CompiledModel& compiledModel) {
+    std::map<std::string, std::string> info;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto it = rtInfo.find("executorTuning");
+        if (it != rtInfo.end()) {
+            info[node->get_friendly_name()] = it->second.as<std::string>();
+        }
+    }
+    return info;
+}
+
+void infer(ov::CompiledModel& compiledModel, size_t times) {
+    auto request = compiledModel.create_infer_request();
+    for (size_t i = 0; i < times; i++) {
+        request.infer();
+    }
+}
+
+TEST(ExecutorTuningCPU, smoke_MeasuredChoicesSurviveExportImport) {
+    ov::Core core;
+    const auto model = ov::test::utils::make_matmul_bias();
+    const ov::AnyMap config = {ov::intel_cpu::executor_autotuning(true), ov::num_streams(1)};
+
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+    // enough runs to finish the trial of every measured node
+    infer(compiledModel, 64);
+
+    std::map<std::string, std::string> measured;
+    for (const auto& [name, info] : getTuningInfo(compiledModel)) {
+        if (info.find(" ms") != std::string::npos) {
+            measured[name] = info.substr(0, info.find(' '));
+        }
+    }
+    if (measured.empty()) {
+        GTEST_SKIP() << "No node has two or more eligible implementations on this platform";
+    }
+
+    std::stringstream blob;
+    compiledModel.export_model(blob);
+    // the export does not change the compiled model, so the second export is the same
+    std::stringstream secondBlob;
+    compiledModel.export_model(secondBlob);
+    ASSERT_EQ(blob.str(), secondBlob.str());
+
+    auto importedModel = core.import_model(blob, ov::test::utils::DEVICE_CPU, config);
+    infer(importedModel, 1);
+
+    const auto importedInfo = getTuningInfo(importedModel);
+    for (const auto& [name, implementation] : measured) {
+        const auto it = importedInfo.find(name);
+        ASSERT_NE(it, importedInfo.end()) << name;
+        ASSERT_EQ(it->second, implementation + " (cached)") << name;
+    }
+}
+
+}  // namespace
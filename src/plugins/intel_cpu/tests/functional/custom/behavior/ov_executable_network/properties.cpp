@@ -6,6 +6,10 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <sstream>
+#include <string>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
@@ -49,12 +53,16 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
         RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
         RO_property(ov::intel_cpu::tbb_partitioner.name()),
+        RO_property(ov::intel_cpu::node_telemetry.name()),
+        RO_property(ov::intel_cpu::queueing_statistics.name()),
         RO_property(ov::hint::dynamic_quantization_group_size.name()),
         RO_property(ov::hint::kv_cache_precision.name()),
         RO_property(ov::key_cache_precision.name()),
         RO_property(ov::value_cache_precision.name()),
         RO_property(ov::key_cache_group_size.name()),
-        RO_property(ov::value_cache_group_size.name())
+        RO_property(ov::value_cache_group_size.name()),
+        // read write
+        ov::PropertyName(ov::hint::model_priority.name(), ov::PropertyMutability::RW)
     };
 
     ov::Core ie;
@@ -91,11 +99,73 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetROPropertiesThrow) {
 
     for (auto it = properties.begin(); it != properties.end(); ++it) {
         ASSERT_TRUE(it != properties.end());
-        ASSERT_FALSE(it->is_mutable());
+        // the priority of the infer requests is the only property which can be changed after the compilation
+        if (*it == ov::hint::model_priority.name()) {
+            ASSERT_TRUE(it->is_mutable());
+        } else {
+            ASSERT_FALSE(it->is_mutable());
+        }
         ASSERT_THROW(compiledModel.set_property({{*it, "DUMMY VALUE"}}), ov::Exception);
     }
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetModelPriority) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    ASSERT_EQ(compiledModel.get_property(ov::hint::model_priority), ov::hint::Priority::MEDIUM);
+
+    compiledModel = ie.compile_model(model, deviceName, ov::hint::model_priority(ov::hint::Priority::HIGH));
+    ASSERT_EQ(compiledModel.get_property(ov::hint::model_priority), ov::hint::Priority::HIGH);
+
+    OV_ASSERT_NO_THROW(compiledModel.set_property(ov::hint::model_priority(ov::hint::Priority::LOW)));
+    ASSERT_EQ(compiledModel.get_property(ov::hint::model_priority), ov::hint::Priority::LOW);
+    // the other properties still can't be changed, the priority is kept
+    ASSERT_THROW(compiledModel.set_property(ov::hint::model_priority(ov::hint::Priority::HIGH), ov::num_streams(2)),
+                 ov::Exception);
+    ASSERT_EQ(compiledModel.get_property(ov::hint::model_priority), ov::hint::Priority::LOW);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkQueueingStatisticsPerRequestPriority) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, ov::num_streams(1));
+    // "<priority>;<tasks>;<average delay us>;<max delay us>" per line
+    auto getTasks = [&compiledModel]() {
+        std::map<std::string, size_t> tasks;
+        std::istringstream report(compiledModel.get_property(ov::intel_cpu::queueing_statistics));
+        for (std::string line; std::getline(report, line);) {
+            const auto separator = line.find(';');
+            EXPECT_NE(separator, std::string::npos) << line;
+            tasks[line.substr(0, separator)] = std::stoul(line.substr(separator + 1));
+        }
+        return tasks;
+    };
+
+    // the requests take the priority of the compiled model at their creation
+    compiledModel.set_property(ov::hint::model_priority(ov::hint::Priority::HIGH));
+    auto highRequest = compiledModel.create_infer_request();
+    compiledModel.set_property(ov::hint::model_priority(ov::hint::Priority::LOW));
+    auto lowRequest = compiledModel.create_infer_request();
+
+    // the executor may be reused from the compiled models released before
+    auto tasks = getTasks();
+    ASSERT_EQ(tasks.size(), 3u);
+    constexpr size_t highInferences = 3;
+    constexpr size_t lowInferences = 5;
+    for (size_t i = 0; i < highInferences; i++) {
+        highRequest.start_async();
+        highRequest.wait();
+    }
+    for (size_t i = 0; i < lowInferences; i++) {
+        lowRequest.start_async();
+        lowRequest.wait();
+    }
+
+    const auto tasksAfter = getTasks();
+    ASSERT_EQ(tasksAfter.at("HIGH") - tasks.at("HIGH"), highInferences);
+    ASSERT_EQ(tasksAfter.at("LOW") - tasks.at("LOW"), lowInferences);
+    ASSERT_EQ(tasksAfter.at("MEDIUM"), tasks.at("MEDIUM"));
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCoreStreamsHasHigherPriorityThanThroughputHint) {
     ov::Core ie;
     int32_t streams = 1;  // throughput hint should apply higher number of streams
@@ -62,6 +62,17 @@ void StringTensorPackLayerCPUTest::generate_inputs(const std::vector<ov::Shape>&
                 ov::test::utils::create_and_fill_tensor_consistently(indicesType, indicesShape, symbolsShape[0], 0, 3);
             endsTensor =
                 ov::test::utils::create_and_fill_tensor_consistently(indicesType, indicesShape, symbolsShape[0], 3, 3);
+            // every 5th string is empty
+            auto makeEmptyStrings = [](const auto* begins, auto* ends, size_t size) {
+                for (size_t i = 0; i < size; i += 5) {
+                    ends[i] = begins[i];
+                }
+            };
+            if (indicesType == ov::element::i32) {
+                makeEmptyStrings(beginsTensor.data<int32_t>(), endsTensor.data<int32_t>(), beginsTensor.get_size());
+            } else {
+                makeEmptyStrings(beginsTensor.data<int64_t>(), endsTensor.data<int64_t>(), beginsTensor.get_size());
+            }
         }
 
         inputs.insert({funcInputs[0].get_node_shared_ptr(), beginsTensor});
@@ -123,6 +134,25 @@ const std::vector<StringTensorPackSpecificParams> StringTensorPackParamsVector =
         InputShape{{-1, -1, -1}, {{1, 1, 3}, {1, 1, 4}, {1, 3, 4}, {1, 3, 4}}},     // begins/ends shape
         InputShape{{-1}, {{9}, {0}, {108}, {0}}},                                   // utf-8 encoded symbols shape
     },
+    // zero-length tensors
+    StringTensorPackSpecificParams{
+        InputShape{{}, {{0}}},                                                      // begins/ends shape
+        InputShape{{}, {{9}}},                                                      // utf-8 encoded symbols shape
+    },
+    StringTensorPackSpecificParams{
+        InputShape{{}, {{2, 0, 3}}},                                                // begins/ends shape
+        InputShape{{}, {{0}}},                                                      // utf-8 encoded symbols shape
+    },
+    // large enough to be split between the threads
+    StringTensorPackSpecificParams{
+        InputShape{{}, {{32, 32, 32}}},                                             // begins/ends shape
+        InputShape{{}, {{3000}}},                                                   // utf-8 encoded symbols shape
+    },
+    // the output strings are reallocated when the shape changes
+    StringTensorPackSpecificParams{
+        InputShape{{-1, -1}, {{64, 512}, {0, 4}, {4, 4}, {64, 512}}},               // begins/ends shape
+        InputShape{{-1}, {{999}, {0}, {48}, {999}}},                                // utf-8 encoded symbols shape
+    },
 };
 
 }  // namespace StringTensorPack
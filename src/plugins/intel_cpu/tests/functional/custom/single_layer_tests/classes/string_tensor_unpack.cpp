@@ -90,6 +90,20 @@ const std::vector<StringTensorUnpackSpecificParams> StringTensorUnpackParamsVect
     StringTensorUnpackSpecificParams {
         InputShape{{3, -1, {3, 8}}, {{3, 1, 3}, {3, 2, 8}}}
     },
+    // zero-length tensors
+    StringTensorUnpackSpecificParams {
+        InputShape{{}, {{0}}}
+    },
+    StringTensorUnpackSpecificParams {
+        InputShape{{}, {{2, 0, 3}}}
+    },
+    // large enough to be split between the threads, the generated strings include empty ones
+    StringTensorUnpackSpecificParams {
+        InputShape{{}, {{32, 32, 32}}}
+    },
+    StringTensorUnpackSpecificParams {
+        InputShape{{-1, -1}, {{64, 512}, {0, 4}, {4, 4}, {64, 512}}}
+    },
 };
 
 }  // namespace StringTensorUnpack
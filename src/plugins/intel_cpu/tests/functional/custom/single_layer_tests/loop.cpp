@@ -455,6 +455,102 @@ protected:
 };
 
 
+// Loop with concatenated output where the number of iterations is given by the trip count parameter:
+// with a constant true body condition the iterations count is known before the execution,
+// so the concatenated output is written in place, otherwise it's collected in the growing buffer.
+using LoopConcatOutputParams = typename std::tuple<
+        std::vector<int64_t>,                                              // Trip count of each inference
+        int64_t,                                                           // Stride of the concatenated output
+        bool,                                                              // Body condition is a constant
+        InputShape>;                                                       // Input shape
+
+class LoopConcatOutputCPUTest : public testing::WithParamInterface<LoopConcatOutputParams>,
+                                virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LoopConcatOutputParams>& obj) {
+        const auto& [trip_counts, stride, const_cond, shape] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({shape.first}) << "_";
+        result << "TS=";
+        for (const auto& item : shape.second) {
+            result << ov::test::utils::vec2str(item) << "_";
+        }
+        result << "trip_counts=" << ov::test::utils::vec2str(trip_counts) << "_";
+        result << "stride=" << stride << "_";
+        result << "const_cond=" << const_cond;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+
+        ov::Tensor trip_count{ov::element::i64, funcInputs[0].get_shape()};
+        trip_count.data<int64_t>()[0] = m_trip_counts[m_infer_idx++ % m_trip_counts.size()];
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), trip_count});
+
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -5;
+        in_data.range = 10;
+        in_data.resolution = 32;
+        inputs.insert({funcInputs[1].get_node_shared_ptr(),
+                       ov::test::utils::create_and_fill_tensor(funcInputs[1].get_element_type(),
+                                                               targetInputStaticShapes[1],
+                                                               in_data)});
+    }
+
+    void SetUp() override {
+        const auto& [trip_counts, stride, const_cond, shape] = this->GetParam();
+        m_trip_counts = trip_counts;
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes({shape});
+        for (auto& target : targetStaticShapes)
+            target.insert(target.begin(), ov::Shape{});
+
+        const auto netType = ov::element::f32;
+        auto trip_count_input = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1});
+        trip_count_input->set_friendly_name("trip_count");
+        auto data = std::make_shared<ov::op::v0::Parameter>(netType, inputDynamicShapes[0]);
+        ov::ParameterVector params{trip_count_input, data};
+
+        // Body: x += 0.5, i += 1, the condition is either a constant or (i < 1000) which is always true here
+        auto body_x = std::make_shared<ov::op::v0::Parameter>(netType, ov::PartialShape::dynamic());
+        auto body_i = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1});
+        auto x_next = std::make_shared<ov::op::v1::Add>(body_x, ov::op::v0::Constant::create(netType, {1}, {0.5f}));
+        auto i_next =
+            std::make_shared<ov::op::v1::Add>(body_i, ov::op::v0::Constant::create(ov::element::i64, {1}, {1}));
+        std::shared_ptr<ov::Node> body_cond;
+        if (const_cond) {
+            body_cond = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, true);
+        } else {
+            body_cond = std::make_shared<ov::op::v1::Less>(body_i,
+                                                           ov::op::v0::Constant::create(ov::element::i64, {1}, {1000}));
+        }
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_cond, x_next, i_next},
+                                                ov::ParameterVector{body_x, body_i});
+
+        auto exec_condition = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, true);
+        auto loop = std::make_shared<ov::op::v5::Loop>(trip_count_input, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ov::op::v5::Loop::SpecialBodyPorts{-1, 0});
+        loop->set_merged_input(body_x, data, x_next);
+        loop->set_merged_input(body_i, ov::op::v0::Constant::create(ov::element::i64, {1}, {0}), i_next);
+
+        auto out0 = loop->get_iter_value(x_next, -1);
+        // concatenation by axis 1 in the forward (start=0, end=-1) or backward (start=-1, end=0) order
+        auto out1 = stride > 0 ? loop->get_concatenated_slices(x_next, 0, 1, 1, -1, 1)
+                               : loop->get_concatenated_slices(x_next, -1, -1, 1, 0, 1);
+
+        auto result0 = std::make_shared<ov::op::v0::Result>(out0);
+        auto result1 = std::make_shared<ov::op::v0::Result>(out1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result0, result1}, params, "loop_concat_output");
+    }
+
+    std::vector<int64_t> m_trip_counts;
+    size_t m_infer_idx = 0;
+};
+
 TEST_P(LoopLayerCPUTest, CompareWithRefs) {
     run();
 }
@@ -471,6 +567,10 @@ TEST_P(LoopForConcatLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+TEST_P(LoopConcatOutputCPUTest, CompareWithRefs) {
+    run();
+}
+
 TEST_F(StaticLoopDynamicSubgraphCPUTest, smoke_StaticLoopWithDynSubgraph) {
     run();
 }
@@ -696,6 +796,22 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcat, LoopForConcatLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// zero iterations follow and precede the non-empty executions, so the state of the previous inference isn't reused
+const std::vector<std::vector<int64_t>> concat_trip_counts = {
+    {3, 0, 5, 5, 1},
+    {0, 4, 0, 2, 2},
+};
+
+const InputShape concat_input_shape = {{-1, 1, -1}, {{2, 1, 3}, {2, 1, 3}, {4, 1, 5}, {4, 1, 5}, {1, 1, 2}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopConcatOutput, LoopConcatOutputCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(concat_trip_counts),
+                                 ::testing::Values(1, -1),
+                                 ::testing::Values(true, false),
+                                 ::testing::Values(concat_input_shape)),
+                         LoopConcatOutputCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
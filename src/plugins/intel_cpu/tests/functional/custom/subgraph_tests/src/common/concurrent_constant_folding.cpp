@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/transpose.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+/*
+ * The weights of every MatMul are a separate constant sub-graph (Multiply -> Transpose), which is folded
+ * concurrently with the others when CPU_CONCURRENT_CONSTANT_FOLDING is enabled.
+ *
+ *   Param   Weights_0 * Scale_0 -> Transpose
+ *      \       /
+ *      MatMul_0   Weights_1 * Scale_1 -> Transpose
+ *          \         /
+ *           MatMul_1   ...
+ */
+class ConcurrentConstantFoldingCPUTest : public testing::WithParamInterface<bool>,
+                                         virtual public SubgraphBaseStaticTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        return obj.param ? "concurrent" : "sequential";
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::concurrent_constant_folding(GetParam()));
+
+        constexpr size_t layers = 8;
+        const ov::Shape shape{4, 16};
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape)};
+        std::shared_ptr<ov::Node> output = params[0];
+        for (size_t i = 0; i < layers; i++) {
+            const auto weightsData =
+                utils::create_and_fill_tensor(ov::element::f32, ov::Shape{16, 16}, utils::InputGenerateData(-1, 2, 64));
+            const auto weights = std::make_shared<ov::op::v0::Constant>(weightsData);
+            const auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {0.5f * (i + 1)});
+            const auto multiply = std::make_shared<ov::op::v1::Multiply>(weights, scale);
+            const auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 0});
+            const auto transpose = std::make_shared<ov::op::v1::Transpose>(multiply, order);
+            output = std::make_shared<ov::op::v0::MatMul>(output, transpose);
+        }
+        function = std::make_shared<ov::Model>(ov::OutputVector{output}, params, "ConcurrentConstantFolding");
+        init_input_shapes(static_shapes_to_test_representation({shape}));
+    }
+};
+
+TEST_P(ConcurrentConstantFoldingCPUTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcurrentConstantFolding,
+                         ConcurrentConstantFoldingCPUTest,
+                         ::testing::Bool(),
+                         ConcurrentConstantFoldingCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
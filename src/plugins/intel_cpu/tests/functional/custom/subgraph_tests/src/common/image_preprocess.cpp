@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/subgraph_builders/preprocess_builders.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// color format, BGR output, NCHW model layout, color conversion on u8, resize
+using ImagePreprocessTestParams = std::tuple<ov::preprocess::ColorFormat, bool, bool, bool, bool>;
+
+class ImagePreprocessCPUTest : public testing::WithParamInterface<ImagePreprocessTestParams>,
+                               virtual public SubgraphBaseStaticTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ImagePreprocessTestParams>& obj) {
+        const auto& [colorFormat, bgr, planar, u8Color, resize] = obj.param;
+        std::ostringstream result;
+        result << (colorFormat == ov::preprocess::ColorFormat::NV12_SINGLE_PLANE ? "NV12_SINGLE_PLANE"
+                                                                                  : "NV12_TWO_PLANES");
+        result << "_" << (bgr ? "BGR" : "RGB");
+        result << "_" << (planar ? "NCHW" : "NHWC");
+        result << "_" << (u8Color ? "ColorU8" : "ColorF32");
+        result << "_" << (resize ? "Resize" : "NoResize");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [colorFormat, bgr, planar, u8Color, resize] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const ov::Shape modelShape = planar ? ov::Shape{1, 3, 28, 36} : ov::Shape{1, 28, 36, 3};
+        auto model = ov::builder::preprocess::create_preprocess_1input(ov::element::f32, modelShape);
+
+        auto ppp = ov::preprocess::PrePostProcessor(model);
+        // without resize the input already has the model spatial shape
+        ppp.input()
+            .tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(colorFormat)
+            .set_spatial_static_shape(resize ? 64 : 28, resize ? 96 : 36);
+        auto& steps = ppp.input().preprocess();
+        const auto colorFormatOut = bgr ? ov::preprocess::ColorFormat::BGR : ov::preprocess::ColorFormat::RGB;
+        // the color conversion on u8 rounds its output, which is then converted to f32
+        if (u8Color) {
+            steps.convert_color(colorFormatOut).convert_element_type(ov::element::f32);
+        } else {
+            steps.convert_element_type(ov::element::f32).convert_color(colorFormatOut);
+        }
+        if (resize) {
+            steps.resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR);
+        }
+        steps.mean({123.675f, 116.28f, 103.53f}).scale({58.395f, 57.12f, 57.375f});
+        ppp.input().model().set_layout(planar ? "NCHW" : "NHWC");
+        function = ppp.build();
+
+        std::vector<ov::Shape> inputShapes;
+        for (const auto& param : function->get_parameters()) {
+            inputShapes.push_back(param->get_shape());
+        }
+        init_input_shapes(static_shapes_to_test_representation(inputShapes));
+    }
+};
+
+TEST_P(ImagePreprocessCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 1);
+    CheckNumberOfNodesWithType(compiledModel, "ColorConvert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImagePreprocess,
+                         ImagePreprocessCPUTest,
+                         ::testing::Combine(::testing::Values(ov::preprocess::ColorFormat::NV12_SINGLE_PLANE,
+                                                              ov::preprocess::ColorFormat::NV12_TWO_PLANES),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()),
+                         ImagePreprocessCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,213 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/op.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// Unary elementwise operation without a CPU implementation: y = 2 * x + 1
+class CustomAffine : public ov::op::util::UnaryElementwiseArithmetic {
+public:
+    OPENVINO_OP("CustomAffine", "extension", ov::op::util::UnaryElementwiseArithmetic);
+
+    CustomAffine() = default;
+    CustomAffine(const ov::Output<ov::Node>& arg) : UnaryElementwiseArithmetic(arg) {
+        constructor_validate_and_infer_types();
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        OPENVINO_ASSERT(new_args.size() == 1, "Incorrect number of new arguments: ", new_args.size(), ". 1 is expected.");
+        return std::make_shared<CustomAffine>(new_args[0]);
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        outputs[0].set_shape(inputs[0].get_shape());
+        const auto* src = inputs[0].data<const float>();
+        auto* dst = outputs[0].data<float>();
+        for (size_t i = 0; i < inputs[0].get_size(); i++) {
+            dst[i] = 2.f * src[i] + 1.f;
+        }
+        return true;
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+};
+
+// Adds a row of the second input to every row of the first one, the second input has either the same number of rows
+// or a single row. Only the former is separable along the first axis.
+class CustomRowAdd : public ov::op::Op {
+public:
+    OPENVINO_OP("CustomRowAdd");
+
+    CustomRowAdd() = default;
+    CustomRowAdd(const ov::OutputVector& args) : Op(args) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        OPENVINO_ASSERT(get_input_size() == 2, "Input count must be 2, Got: ", get_input_size());
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        OPENVINO_ASSERT(new_args.size() == 2, "Incorrect number of new arguments: ", new_args.size(), ". 2 is expected.");
+        return std::make_shared<CustomRowAdd>(new_args);
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        const auto& shape = inputs[0].get_shape();
+        outputs[0].set_shape(shape);
+        const auto rows = shape[0];
+        const auto cols = inputs[0].get_size() / rows;
+        const auto rowsB = inputs[1].get_shape()[0];
+        const auto* a = inputs[0].data<const float>();
+        const auto* b = inputs[1].data<const float>();
+        auto* dst = outputs[0].data<float>();
+        for (size_t r = 0; r < rows; r++) {
+            const auto* rowB = b + (rowsB == 1 ? 0 : r) * cols;
+            for (size_t c = 0; c < cols; c++) {
+                dst[r * cols + c] = a[r * cols + c] + rowB[c];
+            }
+        }
+        return true;
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+};
+
+enum class ReferenceSplitCase {
+    ELEMENTS,         // unary elementwise operation, split over the flattened tensors
+    BATCH,            // declared batch separable, split along the first axis
+    BATCH_BROADCAST,  // declared batch separable, but the inputs disagree on the first axis: not split
+};
+
+// split case, input shape, whether the work is large enough to be split
+using ReferenceSplitCPUTestParams = std::tuple<ReferenceSplitCase, ov::Shape, bool>;
+
+class ReferenceSplitCPUTest : public testing::WithParamInterface<ReferenceSplitCPUTestParams>,
+                              virtual public SubgraphBaseStaticTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ReferenceSplitCPUTestParams>& obj) {
+        const auto& [splitCase, shape, large] = obj.param;
+        std::ostringstream result;
+        switch (splitCase) {
+        case ReferenceSplitCase::ELEMENTS:
+            result << "ELEMENTS";
+            break;
+        case ReferenceSplitCase::BATCH:
+            result << "BATCH";
+            break;
+        case ReferenceSplitCase::BATCH_BROADCAST:
+            result << "BATCH_BROADCAST";
+            break;
+        }
+        result << "_IS=" << ov::test::utils::vec2str(shape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [splitCase, shape, large] = this->GetParam();
+
+        auto in0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        ov::ParameterVector params{in0};
+        std::shared_ptr<ov::Node> op;
+        if (splitCase == ReferenceSplitCase::ELEMENTS) {
+            op = std::make_shared<CustomAffine>(in0);
+        } else {
+            auto shapeB = shape;
+            if (splitCase == ReferenceSplitCase::BATCH_BROADCAST) {
+                shapeB[0] = 1;
+            }
+            auto in1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shapeB);
+            params.push_back(in1);
+            op = std::make_shared<CustomRowAdd>(ov::OutputVector{in0, in1});
+            op->get_rt_info()["cpu_reference_batch_separable"] = true;
+        }
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(op)},
+                                               params,
+                                               "ReferenceSplit");
+
+        std::vector<ov::Shape> inputShapes;
+        for (const auto& param : function->get_parameters()) {
+            inputShapes.push_back(param->get_shape());
+        }
+        init_input_shapes(static_shapes_to_test_representation(inputShapes));
+    }
+
+    void check_fallback_report() {
+        const auto& [splitCase, shape, large] = this->GetParam();
+        const auto threads = compiledModel.get_property(ov::inference_num_threads);
+        const bool expectSplit = large && threads > 1 && splitCase != ReferenceSplitCase::BATCH_BROADCAST;
+        const std::string mode = splitCase == ReferenceSplitCase::ELEMENTS ? "elements" : "batch";
+
+        size_t referenceNodes = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "Reference") {
+                continue;
+            }
+            referenceNodes++;
+            const auto report = rtInfo.at("referenceFallback").as<std::string>();
+            const std::string expected = std::string(splitCase == ReferenceSplitCase::ELEMENTS ? "CustomAffine"
+                                                                                                : "CustomRowAdd") +
+                                         ";split=" + mode + ";splitExecutions=";
+            ASSERT_EQ(report.rfind(expected, 0), 0u) << report;
+            const auto counters = report.substr(expected.size());
+            const auto slash = counters.find('/');
+            ASSERT_NE(slash, std::string::npos) << report;
+            const auto splitExecutions = std::stoul(counters.substr(0, slash));
+            const auto executions = std::stoul(counters.substr(slash + 1));
+            ASSERT_GT(executions, 0u) << report;
+            if (expectSplit) {
+                ASSERT_EQ(splitExecutions, executions) << report;
+            } else {
+                ASSERT_EQ(splitExecutions, 0u) << report;
+            }
+        }
+        ASSERT_EQ(referenceNodes, 1u);
+    }
+};
+
+TEST_P(ReferenceSplitCPUTest, CompareWithRefs) {
+    run();
+    check_fallback_report();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReferenceSplit,
+                         ReferenceSplitCPUTest,
+                         ::testing::Values(ReferenceSplitCPUTestParams{ReferenceSplitCase::ELEMENTS, {8, 64, 256}, true},
+                                           ReferenceSplitCPUTestParams{ReferenceSplitCase::ELEMENTS, {2, 3, 5}, false},
+                                           ReferenceSplitCPUTestParams{ReferenceSplitCase::BATCH, {16, 4096}, true},
+                                           ReferenceSplitCPUTestParams{ReferenceSplitCase::BATCH, {2, 7}, false},
+                                           ReferenceSplitCPUTestParams{ReferenceSplitCase::BATCH_BROADCAST,
+                                                                       {16, 4096},
+                                                                       true}),
+                         ReferenceSplitCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
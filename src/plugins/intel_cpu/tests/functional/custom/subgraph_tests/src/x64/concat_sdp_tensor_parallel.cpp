@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "custom/subgraph_tests/src/classes/concat_sdp.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// Stateful SDPA with the fused KV cache, executed with the heads split between the sub-streams.
+// The contract of query_state() in tensor parallel mode: the states of every sub-stream are returned in the rank
+// order and the KV cache state of a sub-stream holds the heads of its rank only, so the states of the same variable
+// concatenated by the head axis must be equal to the state of the model executed without tensor parallelism.
+class ConcatSDPTensorParallelTest : public ConcatSDPTest {
+protected:
+    using States = std::map<std::string, std::vector<ov::Tensor>>;
+
+    void SetUp() override {
+        ConcatSDPTest::SetUp();
+        configuration.insert({ov::hint::model_distribution_policy.name(), "TENSOR_PARALLEL"});
+        configuration.insert({ov::intel_cpu::enable_tensor_parallel.name(), "true"});
+        configuration.insert({ov::num_streams.name(), "1"});
+    }
+
+    std::vector<ov::Tensor> infer(States& states) {
+        prepare();
+        std::vector<ov::Tensor> outputs;
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx++, shapes);
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+            auto outputTensor = inferRequest.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        for (auto&& state : inferRequest.query_state()) {
+            const auto tensor = state.get_state();
+            ov::Tensor copy{tensor.get_element_type(), tensor.get_shape()};
+            tensor.copy_to(copy);
+            states[state.get_name()].push_back(copy);
+        }
+        reset();
+        return outputs;
+    }
+
+    // Concatenates [B, H_i, L, S] states of the ranks into [B, H, L, S] one
+    static ov::Tensor concat_heads(const std::vector<ov::Tensor>& parts) {
+        auto shape = parts.front().get_shape();
+        shape[1] = 0;
+        for (const auto& part : parts) {
+            const auto& part_shape = part.get_shape();
+            EXPECT_EQ(part_shape.size(), 4u);
+            EXPECT_EQ(part_shape[0], shape[0]);
+            EXPECT_EQ(part_shape[2], shape[2]);
+            EXPECT_EQ(part_shape[3], shape[3]);
+            shape[1] += part_shape[1];
+        }
+        ov::Tensor result{parts.front().get_element_type(), shape};
+        auto* dst = static_cast<uint8_t*>(result.data());
+        for (size_t b = 0; b < shape[0]; b++) {
+            for (const auto& part : parts) {
+                const auto batch_size = part.get_byte_size() / shape[0];
+                std::memcpy(dst, static_cast<const uint8_t*>(part.data()) + b * batch_size, batch_size);
+                dst += batch_size;
+            }
+        }
+        return result;
+    }
+};
+
+TEST_P(ConcatSDPTensorParallelTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto& [inType, inputShapes, kCachePrec, vCachePrec, hasShapeOf, isDiffKVHeadSize] = this->GetParam();
+    States actualStates;
+    auto actualOutputs = infer(actualStates);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+
+    for (const auto& key : {ov::hint::model_distribution_policy.name(),
+                            ov::intel_cpu::enable_tensor_parallel.name(),
+                            ov::num_streams.name()}) {
+        configuration.erase(key);
+    }
+    if (inType == ElementType::f16) {
+        configuration["INFERENCE_PRECISION_HINT"] = "f32";
+    }
+    function = functionRefs;
+    States expectedStates;
+    auto expectedOutputs = infer(expectedStates);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+
+    ASSERT_EQ(actualStates.size(), 2u);
+    ASSERT_EQ(expectedStates.size(), actualStates.size());
+    for (const auto& [name, parts] : actualStates) {
+        const auto expected = expectedStates.find(name);
+        ASSERT_NE(expected, expectedStates.end()) << name;
+        ASSERT_EQ(expected->second.size(), 1u) << name;
+        const auto actual = concat_heads(parts);
+        ASSERT_EQ(actual.get_shape(), expected->second.front().get_shape()) << name;
+        ov::test::utils::compare(expected->second.front(), actual, abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+const std::vector<std::vector<InputShape>> inputShapes = {
+    // greedy search
+    {
+        // B, H, L1, S
+        {{1, 8, -1, 64}, {{1, 8, 10, 64}, {1, 8, 1, 64}, {1, 8, 1, 64}, {1, 8, 20, 64}, {1, 8, 1, 64}}},
+        // B, H, L0, S
+        {{1, 8, -1, 64}, {{1, 8, 0, 64}, {1, 8, 10, 64}, {1, 8, 11, 64}, {1, 8, 12, 64}, {1, 8, 32, 64}}},
+    },
+    // beam search
+    {
+        // B, H, L1, S
+        {{-1, 8, -1, 64}, {{4, 8, 10, 64}, {4, 8, 1, 64}, {4, 8, 1, 64}, {4, 8, 1, 64}, {4, 8, 1, 64}}},
+        // B, H, L0, S
+        {{-1, 8, -1, 64}, {{4, 8, 0, 64}, {4, 8, 10, 64}, {4, 8, 11, 64}, {4, 8, 12, 64}, {4, 8, 13, 64}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTensorParallelTest,
+        ConcatSDPTensorParallelTest,
+        ::testing::Combine(::testing::Values(ElementType::bf16, ElementType::f16),
+                           ::testing::ValuesIn(inputShapes),
+                           ::testing::Values("none"),
+                           ::testing::Values("none"),
+                           ::testing::Values(false),
+                           ::testing::Values(false, true)),
+        ConcatSDPTensorParallelTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/gelu.hpp"
 #include "openvino/op/matmul.hpp"
@@ -13,6 +14,7 @@
 #include "openvino/op/swish.hpp"
 #include "openvino/op/variadic_split.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "transformations/rt_info/decompression.hpp"
 
@@ -26,6 +28,7 @@ struct LLMMLPFusionParams {
     std::string act_type;
     bool use_dynamic_quant;
     bool use_swapped_outputs;  // true = create pattern with swapped VariadicSplit outputs (should still fuse)
+    bool use_tensor_parallel = false;
 };
 
 class LLMMLPFusionTest : public testing::WithParamInterface<LLMMLPFusionParams>, public ov::test::SubgraphBaseTest {
@@ -43,6 +46,7 @@ public:
         result << "act_type=" << obj.param.act_type << "_";
         result << "use_dynamic_quant=" << obj.param.use_dynamic_quant << "_";
         result << "use_swapped_outputs=" << obj.param.use_swapped_outputs << "_";
+        result << "use_tensor_parallel=" << obj.param.use_tensor_parallel << "_";
         result << obj.index;
         return result.str();
     }
@@ -54,6 +58,11 @@ protected:
         auto& param = this->GetParam();
 
         configuration[ov::hint::inference_precision.name()] = "bf16";
+        if (param.use_tensor_parallel) {
+            configuration.insert({ov::hint::model_distribution_policy.name(), "TENSOR_PARALLEL"});
+            configuration.insert({ov::intel_cpu::enable_tensor_parallel.name(), "true"});
+            configuration.insert({ov::num_streams.name(), "1"});
+        }
 
         init_input_shapes({param.inputShape});
 
@@ -198,6 +207,11 @@ const std::vector<LLMMLPFusionParams> mlp_params = {
 
     // Test case with swapped VariadicSplit outputs (should fuse with COMBINED_UP_GATE type)
     {ishape, 4096 / 4, 11008 / 4, "Gelu", false, true},
+
+    // Gate & Up are split by columns and Down by rows between the sub-streams
+    {ishape, 4096 / 4, 11008 / 4, "Swish", false, false, true},
+    {ishape, 4096 / 4, 11008 / 4, "Swish", true, false, true},
+    {ishape, 4096 / 4, 11008 / 4, "Gelu", false, true, true},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_LLMMLPFusion,
@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/node_builders/moe_builders.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov::test {
+
+/*
+ * The gate/up/down GatherMatmul block of MoE3GeMM is collapsed into a single MOE node when CPU_MOE_OP_FUSION is
+ * enabled. The weights are either floating point or compressed to u8/i8/u4/i4 with f32 scales and zero points.
+ */
+struct MoEOpFusionShapeParams {
+    InputShape data_shape;
+    size_t topk;
+    size_t number_of_experts;
+    size_t intermediate_size;
+};
+
+using MoEOpFusionTestParams = std::tuple<MoEOpFusionShapeParams,
+                                         MoEActivationType,      // gate activation type
+                                         ov::test::ElementType,  // weights precision, compressed if integer
+                                         ov::AnyMap>;            // additional config
+
+class MoEOpFusionCPUTest : public testing::WithParamInterface<MoEOpFusionTestParams>,
+                           virtual public SubgraphBaseTest,
+                           public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MoEOpFusionTestParams>& obj) {
+        const auto& [moe_params, activation_type, weights_precision, additional_config] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({moe_params.data_shape.first}) << "_";
+        result << "TS=";
+        for (const auto& static_shape : moe_params.data_shape.second) {
+            result << ov::test::utils::vec2str(static_shape) << ",";
+        }
+        result << "top_k_experts=" << moe_params.topk << "_";
+        result << "total_experts=" << moe_params.number_of_experts << "_";
+        result << "intermediate_size=" << moe_params.intermediate_size << "_";
+        result << "act=" << (activation_type == MoEActivationType::SWISH ? "SWISH" : "GELU") << "_";
+        result << "WP=" << weights_precision << "_";
+        result << "config=(";
+        for (const auto& configEntry : additional_config) {
+            result << configEntry.first << "=" << configEntry.second.as<std::string>() << "_";
+        }
+        result << ")";
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [moe_params, activation_type, weights_precision, additional_config] = GetParam();
+
+        configuration.insert(additional_config.begin(), additional_config.end());
+        configuration.insert(ov::intel_cpu::moe_op_fusion(true));
+        init_input_shapes({moe_params.data_shape});
+        const MoePatternParams shape_params{moe_params.data_shape.first,
+                                            moe_params.topk,
+                                            moe_params.number_of_experts,
+                                            moe_params.intermediate_size};
+        inType = outType = ov::element::f32;
+        rel_threshold = 1e-3f;
+        abs_threshold = 1e-3f;
+
+        auto itr = configuration.find(ov::hint::inference_precision.name());
+        if (itr != configuration.end() && itr->second == ov::element::bf16) {
+            rel_threshold = 0.1f;
+            abs_threshold = 0.1f;
+            inType = outType = ov::element::bf16;
+        }
+
+        const bool compressed = ov::element::Type(weights_precision).is_integral();
+        function = initMoE3GeMMSubgraph(shape_params,
+                                        ov::element::f32,
+                                        weights_precision,
+                                        compressed,
+                                        compressed ? std::optional(ov::element::f32) : std::nullopt,
+                                        compressed ? std::optional(ov::element::f32) : std::nullopt,
+                                        ov::test::utils::DecompressionType::full,
+                                        ov::test::utils::DecompressionType::full,
+                                        false,  // reshape on decompression
+                                        16,     // decompression group size
+                                        MoERoutingType::SOFTMAX,
+                                        activation_type);
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& param = function->get_parameters().front();
+        inputs.insert({param,
+                       ov::test::utils::create_and_fill_tensor(param->get_element_type(),
+                                                               targetInputStaticShapes.front(),
+                                                               ov::test::utils::InputGenerateData(0.125, 2, 8, 1234))});
+    }
+
+    void check_results() {
+        const auto& weights_precision = std::get<2>(GetParam());
+        size_t gather_mm_count = 0;
+        std::vector<std::shared_ptr<ov::Node>> moe_nodes;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            const auto& layer_type = node->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "GatherMatmul") {
+                gather_mm_count++;
+            } else if (layer_type == "MOE") {
+                moe_nodes.push_back(node);
+            }
+        }
+        EXPECT_EQ(gather_mm_count, 0u);
+        ASSERT_EQ(moe_nodes.size(), 1u);
+        // the gate weights are kept in the original precision, compressed ones are decompressed on the fly
+        EXPECT_EQ(moe_nodes.front()->get_input_element_type(3), weights_precision);
+    }
+};
+
+TEST_P(MoEOpFusionCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_results();
+}
+
+namespace {
+
+const std::vector<MoEOpFusionShapeParams> moe_params_smoke = {
+    {
+        {{-1, -1, 256}, {{2, 15, 256}, {2, 1, 256}, {3, 8, 256}}},  // data_shape
+        4,                                                          // topk
+        8,                                                          // number_of_experts
+        512                                                         // intermediate_size
+    },
+    {
+        {{-1, -1, 128}, {{1, 32, 128}, {1, 1, 128}, {1, 16, 128}}},
+        2,
+        4,
+        256
+    },
+};
+
+std::vector<ov::AnyMap> additional_config() {
+    std::vector<ov::AnyMap> config = {{{ov::hint::inference_precision.name(), ov::element::f32}}};
+    if (ov::with_cpu_x86_bfloat16()) {
+        config.push_back({{ov::hint::inference_precision.name(), ov::element::bf16}});
+    }
+    return config;
+}
+
+const std::vector<ov::test::ElementType> weights_precisions = {ov::element::f32,
+                                                               ov::element::u8,
+                                                               ov::element::i8,
+                                                               ov::element::u4,
+                                                               ov::element::i4};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MoEOpFusion,
+                         MoEOpFusionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_smoke),
+                                            ::testing::Values(MoEActivationType::SWISH, MoEActivationType::GELU),
+                                            ::testing::ValuesIn(weights_precisions),
+                                            ::testing::ValuesIn(additional_config())),
+                         MoEOpFusionCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace ov::test
@@ -6,7 +6,9 @@
 #include <vector>
 
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
@@ -22,6 +24,7 @@ struct QKVProjFusionParams {
     size_t k_proj_size;
     size_t v_proj_size;
     bool use_dynamic_quant;
+    bool use_tensor_parallel = false;
 };
 
 class QKVProjFusionTest : public testing::WithParamInterface<QKVProjFusionParams>,
@@ -40,6 +43,7 @@ public:
         result << "k_proj_size=" << obj.param.k_proj_size << "_";
         result << "v_proj_size=" << obj.param.v_proj_size << "_";
         result << "use_dynamic_quant=" << obj.param.use_dynamic_quant << "_";
+        result << "use_tensor_parallel=" << obj.param.use_tensor_parallel << "_";
         result << obj.index;
         return result.str();
     }
@@ -51,6 +55,11 @@ protected:
         auto& param = this->GetParam();
 
         configuration[ov::hint::inference_precision.name()] = "bf16";
+        if (param.use_tensor_parallel) {
+            configuration.insert({ov::hint::model_distribution_policy.name(), "TENSOR_PARALLEL"});
+            configuration.insert({ov::intel_cpu::enable_tensor_parallel.name(), "true"});
+            configuration.insert({ov::num_streams.name(), "1"});
+        }
 
         init_input_shapes({param.inputShape});
 
@@ -129,6 +138,11 @@ const std::vector<QKVProjFusionParams> qkv_params = {
     // Qwen2-7B: hidden_size_per_head:128, num_attention_heads:28, num_key_value_heads:4
     {ishape_qwen2_7b, 3584, 128 * 28, 128 * 4, 128 * 4, false},
     {ishape_qwen2_7b, 3584, 128 * 28, 128 * 4, 128 * 4, true},
+
+    // each projection is split by columns between the sub-streams and the results are gathered
+    {ishape_llama2_7b,  4096, 4096, 4096, 4096, false, true},
+    {ishape_qwen2_7b, 3584, 128 * 28, 128 * 4, 128 * 4, false, true},
+    {ishape_qwen2_7b, 3584, 128 * 28, 128 * 4, 128 * 4, true, true},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_QKVProjFusion,
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/mha.hpp"
+
+#include "utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+namespace {
+
+#if defined(OPENVINO_ARCH_X86_64)
+// Inputs: query, cos, sin, key, value
+std::vector<std::vector<ov::test::InputShape>> inputShapesRoPE{
+    {
+        {{}, {{1, 12, 128, 64}}},
+        {{}, {{1, 1, 128, 64}}},
+        {{}, {{1, 1, 128, 64}}},
+        {{}, {{1, 12, 64, 128}}},
+        {{}, {{1, 12, 128, 64}}}
+    },
+    {
+        {{}, {{2, 8, 32, 32}}},
+        {{}, {{1, 1, 32, 32}}},
+        {{}, {{1, 1, 32, 32}}},
+        {{}, {{2, 8, 32, 48}}},
+        {{}, {{2, 8, 48, 32}}}
+    },
+};
+
+const ov::AnyMap rope_tokenization_config{{"SNIPPETS_MHA_ROPE_TOKENIZATION", true}};
+
+// rotate_half is computed by separate VariadicSplit and Concat nodes,
+// RoPE multiplications and addition are fused into the MHA Subgraph
+static constexpr size_t expected_num_nodes = 3;
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_Snippets_MHARoPE,
+    MHARoPE,
+    ::testing::Combine(::testing::ValuesIn(inputShapesRoPE),
+                       ::testing::Values(std::vector<element::Type>{}),
+                       ::testing::Values(ov::element::f32),
+                       ::testing::Values(false),  // Multiply is a part of RoPE
+                       ::testing::Values(expected_num_nodes),
+                       ::testing::Values(1),
+                       ::testing::Values(ov::test::utils::DEVICE_CPU),
+                       ::testing::Values(rope_tokenization_config)),
+    MHA::getTestCaseName);
+#endif  // OPENVINO_ARCH_X86_64
+
+}  // namespace
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
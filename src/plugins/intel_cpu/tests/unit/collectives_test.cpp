@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "collectives.hpp"
+#include "cpu_parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+template <typename F>
+void run_ranks(int size, const F& func) {
+    std::vector<std::thread> threads;
+    threads.reserve(size);
+    for (int rank = 0; rank < size; ++rank) {
+        threads.emplace_back(func, rank);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+class CollectivesTest : public ::testing::TestWithParam<int> {
+protected:
+    CpuParallel cpu_parallel;
+};
+}  // namespace
+
+TEST_P(CollectivesTest, AllReduce) {
+    const int size = GetParam();
+    Communicator communicator(size);
+    constexpr size_t count = 10007;
+    constexpr int iterations = 100;
+    std::vector<int> errors(size, 0);
+
+    run_ranks(size, [&](int rank) {
+        std::vector<float> data(count);
+        std::vector<float> result(count);
+        for (int it = 0; it < iterations; ++it) {
+            communicator.wait_released(rank);
+            for (size_t i = 0; i < count; ++i) {
+                data[i] = static_cast<float>((rank + 1) * (i % 7) + it);
+            }
+            communicator.all_reduce(rank, data.data(), result.data(), count, ov::element::f32, cpu_parallel);
+            for (size_t i = 0; i < count; ++i) {
+                const auto expected = static_cast<float>(size * (size + 1) / 2 * (i % 7) + size * it);
+                errors[rank] += result[i] != expected;
+            }
+        }
+        communicator.wait_released(rank);
+    });
+
+    for (int rank = 0; rank < size; ++rank) {
+        ASSERT_EQ(errors[rank], 0) << "rank " << rank;
+    }
+}
+
+TEST_P(CollectivesTest, AllReduceInPlaceBf16) {
+    const int size = GetParam();
+    Communicator communicator(size);
+    constexpr size_t count = 777;
+    std::vector<int> errors(size, 0);
+
+    run_ranks(size, [&](int rank) {
+        std::vector<ov::bfloat16> data(count, ov::bfloat16(static_cast<float>(rank)));
+        communicator.all_reduce(rank, data.data(), data.data(), count, ov::element::bf16, cpu_parallel);
+        for (size_t i = 0; i < count; ++i) {
+            errors[rank] += static_cast<float>(data[i]) != static_cast<float>(size * (size - 1) / 2);
+        }
+        communicator.wait_released(rank);
+    });
+
+    for (int rank = 0; rank < size; ++rank) {
+        ASSERT_EQ(errors[rank], 0) << "rank " << rank;
+    }
+}
+
+TEST_P(CollectivesTest, ReduceScatter) {
+    const int size = GetParam();
+    Communicator communicator(size);
+    constexpr size_t count = 1001;
+    std::vector<int> errors(size, 0);
+
+    run_ranks(size, [&](int rank) {
+        std::vector<float> data(count, static_cast<float>(rank + 1));
+        const auto [offset, part] =
+            communicator.reduce_scatter(rank, data.data(), count, ov::element::f32, cpu_parallel);
+        for (size_t i = offset; i < offset + part; ++i) {
+            errors[rank] += data[i] != static_cast<float>(size * (size + 1) / 2);
+        }
+        communicator.wait_released(rank);
+    });
+
+    for (int rank = 0; rank < size; ++rank) {
+        ASSERT_EQ(errors[rank], 0) << "rank " << rank;
+    }
+}
+
+TEST_P(CollectivesTest, AllGatherUnevenParts) {
+    const int size = GetParam();
+    Communicator communicator(size);
+    constexpr size_t rows = 33;
+    constexpr size_t columns = 10;
+    std::vector<int> errors(size, 0);
+
+    run_ranks(size, [&](int rank) {
+        const auto part = communicator.get_part(rank, columns).second;
+        std::vector<uint8_t> src(rows * part, static_cast<uint8_t>(rank));
+        std::vector<uint8_t> dst(rows * columns);
+        communicator.all_gather(rank, src.data(), part, dst.data(), rows, cpu_parallel);
+        communicator.barrier(rank);
+        for (size_t row = 0; row < rows; ++row) {
+            for (int r = 0; r < size; ++r) {
+                const auto [offset, r_part] = communicator.get_part(r, columns);
+                for (size_t i = offset; i < offset + r_part; ++i) {
+                    errors[rank] += dst[row * columns + i] != static_cast<uint8_t>(r);
+                }
+            }
+        }
+    });
+
+    for (int rank = 0; rank < size; ++rank) {
+        ASSERT_EQ(errors[rank], 0) << "rank " << rank;
+    }
+}
+
+// Microbenchmark of the collectives latency depending on the sub-streams count
+TEST_P(CollectivesTest, DISABLED_Latency) {
+    const int size = GetParam();
+    Communicator communicator(size);
+    constexpr size_t count = 4096 * 16;
+    constexpr int iterations = 1000;
+    std::vector<double> all_reduce_us(size);
+    std::vector<double> all_gather_us(size);
+
+    run_ranks(size, [&](int rank) {
+        std::vector<float> data(count, 1.F);
+        std::vector<float> reduced(count);
+        std::vector<float> gathered(count * size);
+        auto measure = [&](const auto& collective) {
+            communicator.barrier(rank);
+            const auto start = std::chrono::steady_clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                communicator.wait_released(rank);
+                collective();
+            }
+            communicator.wait_released(rank);
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+        };
+        all_reduce_us[rank] = measure([&]() {
+            communicator.all_reduce(rank, data.data(), reduced.data(), count, ov::element::f32, cpu_parallel);
+        });
+        all_gather_us[rank] = measure([&]() {
+            communicator.all_gather(rank, data.data(), count * sizeof(float), gathered.data(), 1, cpu_parallel);
+        });
+    });
+
+    std::cout << "sub-streams: " << size << ", f32 elements: " << count << ", all_reduce: " << all_reduce_us[0]
+              << " us, all_gather: " << all_gather_us[0] << " us" << '\n';
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Collectives, CollectivesTest, ::testing::Values(1, 2, 3, 4, 8));
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "node_telemetry.h"
+
+using namespace ov::intel_cpu;
+
+TEST(NodeTelemetryTests, BucketIdx) {
+    ASSERT_EQ(NodeTelemetry::bucketIdx(0), 0U);
+    ASSERT_EQ(NodeTelemetry::bucketIdx(1), 1U);
+    ASSERT_EQ(NodeTelemetry::bucketIdx(1023), 10U);
+    ASSERT_EQ(NodeTelemetry::bucketIdx(1024), 11U);
+    ASSERT_EQ(NodeTelemetry::bucketIdx(UINT64_MAX), NodeTelemetry::bucketsNum - 1);
+}
+
+TEST(NodeTelemetryTests, ReportIsAggregatedOverStreams) {
+    NodeTelemetry telemetry(10);
+    constexpr size_t numStreams = 4;
+    constexpr size_t numSamples = 100;
+
+    std::vector<std::thread> streams;
+    for (size_t i = 0; i < numStreams; ++i) {
+        auto buffer = telemetry.createStreamBuffer();
+        auto& conv = buffer->registerNode("conv", "Convolution");
+        auto& relu = buffer->registerNode("relu", "Eltwise");
+        auto& add = buffer->registerNode("add", "Eltwise");
+        streams.emplace_back([buffer, &conv, &relu, &add]() {
+            for (size_t j = 0; j < numSamples; ++j) {
+                conv.add(4000);
+                relu.add(1000);
+                add.add(1000);
+            }
+        });
+    }
+    // the report may be requested concurrently with the inference
+    ASSERT_NO_THROW(telemetry.getReport());
+    for (auto& stream : streams) {
+        stream.join();
+    }
+
+    std::istringstream report(telemetry.getReport());
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(report, line);) {
+        lines.push_back(line);
+    }
+    // 1000ns and 4000ns go to [512, 1024) and [2048, 4096) buckets
+    const std::vector<std::string> expected{"node;add;Eltwise;400;1.000;1.024;1.024;1.024",
+                                            "node;conv;Convolution;400;4.000;4.096;4.096;4.096",
+                                            "node;relu;Eltwise;400;1.000;1.024;1.024;1.024",
+                                            "type;Convolution;Convolution;400;4.000;4.096;4.096;4.096",
+                                            "type;Eltwise;Eltwise;800;1.000;1.024;1.024;1.024"};
+    ASSERT_EQ(lines, expected);
+}
+
+TEST(NodeTelemetryTests, NotExecutedNodesAreSkipped) {
+    NodeTelemetry telemetry(1);
+    auto buffer = telemetry.createStreamBuffer();
+    buffer->registerNode("conv", "Convolution");
+    ASSERT_TRUE(telemetry.getReport().empty());
+}
+
+TEST(NodeTelemetryTests, SamplingIsDecidedOncePerInference) {
+    NodeTelemetry telemetry(3);
+    auto buffer = telemetry.createStreamBuffer();
+    ASSERT_FALSE(buffer->isSampled());
+
+    std::vector<bool> sampled;
+    for (size_t i = 0; i < 6; ++i) {
+        buffer->startInference();
+        // the body graphs executed within the inference read the same decision any number of times
+        const bool isSampled = buffer->isSampled();
+        ASSERT_EQ(buffer->isSampled(), isSampled);
+        sampled.push_back(isSampled);
+    }
+    const std::vector<bool> expected{true, false, false, true, false, false};
+    ASSERT_EQ(sampled, expected);
+}
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,7 +12,9 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/shared_multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
+#include "openvino/core/except.hpp"
 
 using namespace ov::intel_cpu;
 
@@ -85,6 +90,23 @@ TEST(LruCacheTests, LruPolicy) {
     }
 }
 
+TEST(LruCacheTests, Erase) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    OV_ASSERT_NO_THROW(cache.erase({5}));
+    OV_ASSERT_NO_THROW(cache.erase({5}));
+    OV_ASSERT_NO_THROW(cache.erase({capacity}));
+    ASSERT_EQ(cache.get({5}), int());
+    for (int i = 1; i < capacity; ++i) {
+        if (i != 5) {
+            ASSERT_EQ(cache.get({i}), i);
+        }
+    }
+}
+
 TEST(LruCacheTests, Empty) {
     constexpr size_t capacity = 0;
     constexpr int attempts = 10;
@@ -380,3 +402,86 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(SharedMultiCacheTests, BuildOnceForConcurrentRequests) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    std::atomic<size_t> numBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        ++numBuilds;
+        return std::make_shared<int>(key.data);
+    };
+
+    SharedMultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(result.first, IntValueType());
+            ASSERT_EQ(*result.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    ASSERT_EQ(numBuilds, static_cast<size_t>(capacity));
+}
+
+TEST(SharedMultiCacheTests, BuildDifferentKeysConcurrently) {
+    SharedMultiCache cache(10);
+
+    // The first builder can finish only if the second one runs at the same time
+    std::promise<void> secondStarted;
+    auto secondStartedFuture = secondStarted.get_future();
+    std::atomic<bool> builtConcurrently{false};
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(2);
+        vecThreads.emplace_back(std::thread([&]() {
+            cache.getOrCreate(IntKey{0}, [&](const IntKey& key) {
+                builtConcurrently = secondStartedFuture.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+                return std::make_shared<int>(key.data);
+            });
+        }));
+        vecThreads.emplace_back(std::thread([&]() {
+            cache.getOrCreate(IntKey{1}, [&](const IntKey& key) {
+                secondStarted.set_value();
+                return std::make_shared<int>(key.data);
+            });
+        }));
+    }
+
+    ASSERT_TRUE(builtConcurrently);
+}
+
+TEST(SharedMultiCacheTests, FailedBuildIsNotCached) {
+    SharedMultiCache cache(10);
+
+    auto failingBuilder = [](const IntKey& key) -> std::shared_ptr<int> {
+        OPENVINO_THROW("Failed to build ", key.data);
+    };
+    ASSERT_THROW(cache.getOrCreate(IntKey{0}, failingBuilder), ov::Exception);
+
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+    auto result = cache.getOrCreate(IntKey{0}, builder);
+    ASSERT_NE(result.first, nullptr);
+    ASSERT_EQ(*result.first, 0);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+
+    // the value built after the failure is cached
+    auto cached = cache.getOrCreate(IntKey{0}, builder);
+    ASSERT_EQ(cached.first, result.first);
+    ASSERT_EQ(cached.second, CacheEntryBase::LookUpStatus::Hit);
+}
@@ -7,6 +7,9 @@
     #include "transformations/tpp/common/pass/lowered/brgemm_tpp_blocking.hpp"
 #endif
 
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "emitters/snippets/x64/kernel_executors/brgemm_blocking_tuner.hpp"
 #include "lir_test_utils.hpp"
 #include "openvino/opsets/opset10_decl.hpp"
 #include "snippets/lowered/loop_info.hpp"
@@ -24,7 +27,8 @@ using namespace ov::intel_cpu;
 using namespace ov::snippets::lowered;
 using namespace ov::snippets::lowered::pass;
 using namespace ov::snippets;
-using namespace dnnl::impl::cpu;
+// Note: the alias hides ov::intel_cpu::x64 which is visible due to the using-directive above
+namespace x64 = dnnl::impl::cpu::x64;
 using BrgemmConfig = intel_cpu::brgemm_utils::BrgemmConfig;
 using PortType = LoopPort::Type;
 using PortDescriptor = ov::snippets::modifier::MemoryAccess::PortDescriptor;
@@ -507,6 +511,62 @@ TEST_F(BrgemmCPUBlockingTest, AMX_FC) {
     }
 }
 
+class BrgemmCPUBlockingTunedTest : public BrgemmBlockingTest {
+public:
+    BrgemmCPUBlockingTunedTest() = default;
+
+    void SetUp() override {
+        m_db_path = ov::test::utils::generateTestFilePrefix() + "_brgemm_tuning.db";
+        m_db = ov::intel_cpu::x64::BrgemmTuningDB::get(m_db_path);
+        pipeline.register_pass<ov::intel_cpu::pass::BrgemmCPUBlocking>(
+            std::make_shared<ov::intel_cpu::x64::BrgemmBlockingTuner>(m_db));
+    }
+
+    void TearDown() override {
+        BrgemmBlockingTest::TearDown();
+        ov::test::utils::removeFile(m_db_path);
+    }
+
+protected:
+    std::string m_db_path;
+    std::shared_ptr<ov::intel_cpu::x64::BrgemmTuningDB> m_db;
+};
+
+TEST_F(BrgemmCPUBlockingTunedTest, BlockingFromTuningDB) {
+    const ov::Dimension::value_type m = 384;
+    const ov::Dimension::value_type n = 384;
+    const ov::Dimension::value_type k = 1024;
+    const ov::PartialShape input_shape_a{1, 16, m, k};
+    const ov::PartialShape input_shape_b{1, 16, k, n};
+    const auto precision = ov::element::f32;
+    const BrgemmConfig brgemm_config(x64::cpu_isa_t::avx512_core, precision, precision, precision, false, false);
+    // The DB record overrides the default blocking (32, 64, 512), so no benchmark is run
+    m_blk = 64;
+    n_blk = 32;
+    k_blk = 256;
+    m_db->insert({m, n, k, precision, precision, brgemm_config.isa(), brgemm_config.with_wei_repacking(),
+                  brgemm_config.transposed_b()},
+                 {m_blk, n_blk, k_blk});
+
+    {
+        auto data_a = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second}, brgemm_config);
+        init_expr_descriptors(*brgemm.first, {});
+        auto result = linear_ir->push_node<ov::snippets::op::Result>(brgemm.second);
+    }
+    {
+        auto data_a = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir_ref->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second}, brgemm_config);
+        const auto& brgemm_expr = *brgemm.first;
+        init_expr_descriptors(brgemm_expr, {{m_blk, k_blk}, {k_blk, n_blk}, {m_blk, n_blk}});
+        create_brgemm_loop_infos(linear_ir_ref, brgemm_expr, m, m_blk, k, k_blk, n, n_blk);
+        brgemm_expr->set_loop_ids({2, 1, 0});
+        auto result = linear_ir_ref->push_node<ov::snippets::op::Result>(brgemm.second);
+    }
+}
+
 #ifdef SNIPPETS_LIBXSMM_TPP
 class BrgemmTPPBlockingTest : public BrgemmBlockingTest {
 public:
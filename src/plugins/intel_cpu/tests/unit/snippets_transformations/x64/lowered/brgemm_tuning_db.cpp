@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "emitters/snippets/x64/kernel_executors/brgemm_blocking_tuner.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+using namespace ov::intel_cpu::x64;
+using namespace dnnl::impl::cpu::x64;
+
+class BrgemmTuningDBTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = ov::test::utils::generateTestFilePrefix() + "_brgemm_tuning.db";
+    }
+    void TearDown() override {
+        ov::test::utils::removeFile(m_path);
+    }
+
+    std::string m_path;
+};
+
+TEST_F(BrgemmTuningDBTest, records_are_persisted) {
+    const BrgemmTuningDB::Key key{384, 384, 1024, ov::element::f32, ov::element::f32, avx512_core};
+    const BrgemmBlocking blocking{64, 48, 512};
+    {
+        BrgemmTuningDB db(m_path);
+        EXPECT_FALSE(db.find(key).has_value());
+        db.insert(key, blocking);
+        ASSERT_TRUE(db.find(key).has_value());
+    }
+
+    BrgemmTuningDB reloaded(m_path);
+    const auto found = reloaded.find(key);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(*found, blocking);
+
+    auto other_isa = key;
+    other_isa.isa = avx2;
+    EXPECT_FALSE(reloaded.find(other_isa).has_value());
+
+    auto repacked = key;
+    repacked.with_wei_repacking = true;
+    EXPECT_FALSE(reloaded.find(repacked).has_value());
+
+    auto transposed = key;
+    transposed.transposed_b = true;
+    EXPECT_FALSE(reloaded.find(transposed).has_value());
+}
+
+TEST_F(BrgemmTuningDBTest, last_record_wins_and_corrupted_records_are_skipped) {
+    {
+        std::ofstream file(m_path);
+        file << "128 64 32 f32 f32 " << static_cast<uint64_t>(avx2) << " 0 0 32 64 32\n";
+        file << "corrupted record\n";
+        file << "128 64 32 f32 f32 " << static_cast<uint64_t>(avx2) << " 0 0 16 64 32\n";
+        file << "128 64 32 unknown_type f32 " << static_cast<uint64_t>(avx2) << " 0 0 64 64 32\n";
+        // records without the weights layout flags are skipped
+        file << "128 64 32 f32 f32 " << static_cast<uint64_t>(avx2) << " 8 64 32\n";
+    }
+    BrgemmTuningDB db(m_path);
+    const auto found = db.find({128, 64, 32, ov::element::f32, ov::element::f32, avx2});
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(*found, (BrgemmBlocking{16, 64, 32}));
+}
+
+TEST_F(BrgemmTuningDBTest, tuner_returns_db_record_without_benchmarking) {
+    const BrgemmTuningDB::Key key{384, 384, 1024, ov::element::f32, ov::element::f32, avx512_core};
+    const BrgemmBlocking blocking{64, 32, 256};
+    const auto db = BrgemmTuningDB::get(m_path);
+    db->insert(key, blocking);
+
+    // The record is not among the candidates: it can be returned only from the DB
+    BrgemmBlockingTuner tuner(db);
+    EXPECT_EQ(tuner.tune(key, {BrgemmBlocking{32, 64, 512}}), blocking);
+    EXPECT_EQ(tuner.take_report(), "384x384x1024:64/32/256");
+    EXPECT_EQ(tuner.take_report(), "");
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "spin_worker_pool.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+class SpinWorkerPoolTest : public ::testing::TestWithParam<uint32_t> {
+protected:
+    static constexpr int num_threads = 4;
+    SpinWorkerPool pool{num_threads, GetParam(), false};
+};
+}  // namespace
+
+TEST_P(SpinWorkerPoolTest, EveryJobIsExecutedOnce) {
+    for (int nthr = 0; nthr <= 3 * num_threads; ++nthr) {
+        std::vector<std::atomic<int>> executed(nthr);
+        pool.run(nthr, [&](int ithr, int n) {
+            ASSERT_EQ(n, nthr);
+            executed[ithr]++;
+        });
+        for (const auto& count : executed) {
+            ASSERT_EQ(count.load(), 1);
+        }
+        // let the workers park between the regions
+        std::this_thread::sleep_for(std::chrono::microseconds(nthr * 20));
+    }
+}
+
+TEST_P(SpinWorkerPoolTest, Barrier) {
+    std::atomic<int> arrived{0};
+    std::atomic<bool> passed_early{false};
+    for (int it = 0; it < 100; ++it) {
+        arrived = 0;
+        pool.run(num_threads, [&](int, int) {
+            arrived++;
+            pool.barrier();
+            if (arrived != num_threads) {
+                passed_early = true;
+            }
+            pool.barrier();
+        });
+    }
+    ASSERT_FALSE(passed_early);
+}
+
+TEST_P(SpinWorkerPoolTest, NestedRegionIsSequential) {
+    std::atomic<int> executed{0};
+    pool.run(num_threads, [&](int, int) {
+        ASSERT_TRUE(SpinWorkerPool::in_region());
+        pool.run(num_threads, [&](int, int) {
+            executed++;
+        });
+    });
+    ASSERT_FALSE(SpinWorkerPool::in_region());
+    ASSERT_EQ(executed.load(), num_threads * num_threads);
+}
+
+TEST_P(SpinWorkerPoolTest, BarrierInNestedRegion) {
+    std::atomic<int> executed{0};
+    pool.run(num_threads, [&](int ithr, int) {
+        // only one of the threads runs a nested region, its barriers must not count as the ones of the outer region
+        if (ithr == 0) {
+            pool.run(num_threads, [&](int, int) {
+                pool.barrier();
+                executed++;
+            });
+        }
+        pool.barrier();
+    });
+    ASSERT_EQ(executed.load(), num_threads);
+}
+
+TEST_P(SpinWorkerPoolTest, BarrierInContendedRegion) {
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::thread busy([&]() {
+        pool.run(num_threads, [&](int ithr, int) {
+            if (ithr == 0) {
+                started = true;
+            }
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+    });
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    // the pool is busy, so the region runs sequentially on the calling thread
+    std::atomic<int> executed{0};
+    pool.run(num_threads, [&](int, int) {
+        pool.barrier();
+        executed++;
+    });
+    ASSERT_EQ(executed.load(), num_threads);
+
+    release = true;
+    busy.join();
+}
+
+TEST_P(SpinWorkerPoolTest, ExceptionIsPropagated) {
+    ASSERT_THROW(pool.run(num_threads,
+                          [&](int ithr, int) {
+                              if (ithr == num_threads - 1) {
+                                  throw std::runtime_error("job failure");
+                              }
+                          }),
+                 std::runtime_error);
+    // the pool stays usable
+    std::atomic<int> executed{0};
+    pool.run(num_threads, [&](int, int) {
+        executed++;
+    });
+    ASSERT_EQ(executed.load(), num_threads);
+}
+
+TEST_P(SpinWorkerPoolTest, CpuParallelDispatch) {
+    auto worker_pool = std::make_shared<SpinWorkerPool>(num_threads, GetParam(), false);
+    CpuParallel cpu_parallel(ov::intel_cpu::TbbPartitioner::STATIC, CpuParallel::default_multiplier, worker_pool);
+    ASSERT_EQ(cpu_parallel.get_num_threads(), num_threads);
+
+    constexpr size_t D0 = 7;
+    constexpr size_t D1 = 5;
+    std::vector<std::atomic<int>> executed(D0 * D1);
+    cpu_parallel.parallel_for2d(D0, D1, [&](size_t d0, size_t d1) {
+        executed[d0 * D1 + d1]++;
+    });
+    for (const auto& count : executed) {
+        ASSERT_EQ(count.load(), 1);
+    }
+
+    const auto sum = cpu_parallel.parallel_sum(D0 * D1, size_t{0}, [](size_t i) {
+        return i;
+    });
+    ASSERT_EQ(sum, D0 * D1 * (D0 * D1 - 1) / 2);
+}
+
+// Microbenchmark of the dispatch overhead of an empty parallel region, worker pool against TBB
+TEST_P(SpinWorkerPoolTest, DISABLED_DispatchLatency) {
+    const int nthr = parallel_get_max_threads();
+    constexpr int iterations = 100000;
+    auto worker_pool = std::make_shared<SpinWorkerPool>(nthr, GetParam(), true);
+    const CpuParallel tbb_parallel(ov::intel_cpu::TbbPartitioner::STATIC);
+    const CpuParallel pool_parallel(ov::intel_cpu::TbbPartitioner::STATIC,
+                                    CpuParallel::default_multiplier,
+                                    worker_pool);
+    std::vector<int> data(nthr);
+
+    auto measure = [&](const CpuParallel& cpu_parallel) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            cpu_parallel.parallel_for(nthr, [&](int ithr) {
+                data[ithr]++;
+            });
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+    };
+
+    const auto tbb_us = measure(tbb_parallel);
+    const auto pool_us = measure(pool_parallel);
+    std::cout << "threads: " << nthr << ", spin time: " << GetParam() << " us, tbb: " << tbb_us
+              << " us, worker pool: " << pool_us << " us" << '\n';
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SpinWorkerPool, SpinWorkerPoolTest, ::testing::Values(0U, 50U));
@@ -0,0 +1,279 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "executor_tuning_cache.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/executor_implementation.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/executors/tuned_executor.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct FakeAttrs {};
+
+// Counts the executors alive and the calls per implementation
+struct FakeStats {
+    size_t alive = 0;
+    size_t maxAlive = 0;
+    std::map<std::string, size_t> created;
+    std::map<std::string, size_t> executed;
+};
+
+class FakeExecutor : public Executor {
+public:
+    FakeExecutor(std::string name, std::chrono::microseconds duration, FakeStats& stats)
+        : m_name(std::move(name)),
+          m_duration(duration),
+          m_stats(stats) {
+        m_stats.created[m_name]++;
+        m_stats.maxAlive = std::max(m_stats.maxAlive, ++m_stats.alive);
+    }
+    ~FakeExecutor() override {
+        m_stats.alive--;
+    }
+
+    bool update([[maybe_unused]] const MemoryArgs& memory) override {
+        return true;
+    }
+    void execute([[maybe_unused]] const MemoryArgs& memory) override {
+        m_stats.executed[m_name]++;
+        if (m_duration.count() > 0) {
+            std::this_thread::sleep_for(m_duration);
+        }
+    }
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::ref;
+    }
+    void moveMemToNumaNode([[maybe_unused]] int numaID) override {}
+
+private:
+    std::string m_name;
+    std::chrono::microseconds m_duration;
+    FakeStats& m_stats;
+};
+
+class TunedExecutorTest : public ::testing::Test {
+protected:
+    using Implementation = ExecutorImplementation<FakeAttrs>;
+
+    // a trial takes one warm-up and three measured runs per candidate
+    static constexpr size_t runsPerCandidate = 4;
+
+    void addImplementation(const char* name, std::chrono::microseconds duration, size_t maxRows = SIZE_MAX) {
+        m_implementations.push_back(std::make_unique<Implementation>(
+            name,
+            ExecutorType::Reference,
+            OperationType::FullyConnected,
+            [](const executor::Config<FakeAttrs>&) {
+                return true;
+            },
+            nullptr,
+            [maxRows](const FakeAttrs&, const MemoryArgs& memory) {
+                return memory.at(ARG_SRC)->getStaticDims()[0] <= maxRows;
+            },
+            [name, duration, this](const FakeAttrs&, const MemoryArgs&, const ExecutorContext::CPtr&) {
+                return std::make_shared<FakeExecutor>(name, duration, m_stats);
+            }));
+    }
+
+    std::shared_ptr<TunedExecutor<FakeAttrs>> makeExecutor(const ExecutorTuningCachePtr& cache) {
+        std::vector<TunedExecutor<FakeAttrs>::ExecutorImplementationRef> implementations;
+        for (const auto& impl : m_implementations) {
+            implementations.emplace_back(*impl);
+        }
+        return std::make_shared<TunedExecutor<FakeAttrs>>(MemoryArgs{},
+                                                          FakeAttrs{},
+                                                          nullptr,
+                                                          implementations,
+                                                          cache,
+                                                          false);
+    }
+
+    static MemoryArgs makeMemory(size_t rows, size_t weightRows = 16, size_t weightCols = 32) {
+        dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+        MemoryArgs memory;
+        memory[ARG_SRC] = std::make_shared<Memory>(
+            eng,
+            std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(VectorDims{rows, 32})));
+        memory[ARG_WEI] = std::make_shared<Memory>(
+            eng,
+            std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(VectorDims{weightRows, weightCols})));
+        memory[ARG_DST] = std::make_shared<Memory>(
+            eng,
+            std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(VectorDims{rows, weightRows})));
+        return memory;
+    }
+
+    static void run(Executor& executor, const MemoryArgs& memory, size_t times) {
+        for (size_t i = 0; i < times; i++) {
+            executor.execute(memory);
+        }
+    }
+
+    FakeStats m_stats;
+    std::vector<std::unique_ptr<Implementation>> m_implementations;
+};
+
+TEST_F(TunedExecutorTest, SelectsFastestImplementation) {
+    addImplementation("slow", std::chrono::microseconds(2000));
+    addImplementation("fast", std::chrono::microseconds(0));
+    auto cache = std::make_shared<ExecutorTuningCache>();
+    auto executor = makeExecutor(cache);
+    const auto memory = makeMemory(3);
+
+    ASSERT_TRUE(executor->update(memory));
+    run(*executor, memory, 2 * runsPerCandidate);
+
+    ASSERT_EQ(executor->tuningInfo().rfind("fast (", 0), 0U) << executor->tuningInfo();
+    ASSERT_EQ(cache->size(), 1U);
+    ASSERT_EQ(m_stats.executed["slow"], runsPerCandidate);
+    ASSERT_EQ(m_stats.executed["fast"], runsPerCandidate);
+
+    // the choice is used afterwards
+    run(*executor, memory, 5);
+    ASSERT_EQ(m_stats.executed["slow"], runsPerCandidate);
+    ASSERT_EQ(m_stats.executed["fast"], runsPerCandidate + 5);
+}
+
+TEST_F(TunedExecutorTest, CandidatesAreCreatedOneAtATime) {
+    addImplementation("first", std::chrono::microseconds(0));
+    addImplementation("second", std::chrono::microseconds(1000));
+    addImplementation("third", std::chrono::microseconds(1000));
+    auto executor = makeExecutor(std::make_shared<ExecutorTuningCache>());
+    const auto memory = makeMemory(3);
+
+    ASSERT_TRUE(executor->update(memory));
+    ASSERT_EQ(m_stats.created.size(), 1U);
+    run(*executor, memory, 3 * runsPerCandidate);
+
+    ASSERT_EQ(m_stats.maxAlive, 1U);
+    ASSERT_EQ(m_stats.alive, 1U);
+    ASSERT_EQ(executor->tuningInfo().rfind("first (", 0), 0U) << executor->tuningInfo();
+    // the winner was released while the others were measured and is recreated
+    ASSERT_EQ(m_stats.created["first"], 2U);
+    ASSERT_EQ(m_stats.created["second"], 1U);
+    ASSERT_EQ(m_stats.created["third"], 1U);
+}
+
+TEST_F(TunedExecutorTest, SameBucketKeepsTrialInProgress) {
+    addImplementation("a", std::chrono::microseconds(0));
+    addImplementation("b", std::chrono::microseconds(0));
+    auto cache = std::make_shared<ExecutorTuningCache>();
+    auto executor = makeExecutor(cache);
+
+    ASSERT_TRUE(executor->update(makeMemory(3)));
+    run(*executor, makeMemory(3), runsPerCandidate + 1);
+    // 3 and 4 rows share the bucket of 4
+    ASSERT_TRUE(executor->update(makeMemory(4)));
+    run(*executor, makeMemory(4), runsPerCandidate - 1);
+
+    ASSERT_EQ(cache->size(), 1U);
+    ASSERT_EQ(m_stats.executed["a"], runsPerCandidate);
+    ASSERT_EQ(m_stats.executed["b"], runsPerCandidate);
+}
+
+TEST_F(TunedExecutorTest, NewBucketRestartsTrial) {
+    addImplementation("a", std::chrono::microseconds(0));
+    addImplementation("b", std::chrono::microseconds(0));
+    auto cache = std::make_shared<ExecutorTuningCache>();
+    auto executor = makeExecutor(cache);
+
+    ASSERT_TRUE(executor->update(makeMemory(3)));
+    run(*executor, makeMemory(3), runsPerCandidate + 1);
+    // 5 rows fall into the bucket of 8, the unfinished trial is dropped
+    ASSERT_TRUE(executor->update(makeMemory(5)));
+    run(*executor, makeMemory(5), 2 * runsPerCandidate);
+
+    ASSERT_EQ(cache->size(), 1U);
+    ASSERT_EQ(m_stats.executed["a"], 2 * runsPerCandidate);
+    ASSERT_EQ(m_stats.executed["b"], 1 + runsPerCandidate);
+}
+
+TEST_F(TunedExecutorTest, KeyBucketsActivationsOnly) {
+    addImplementation("a", std::chrono::microseconds(0));
+    addImplementation("b", std::chrono::microseconds(0));
+    auto cache = std::make_shared<ExecutorTuningCache>();
+    auto executor = makeExecutor(cache);
+
+    ASSERT_TRUE(executor->update(makeMemory(5)));
+    run(*executor, makeMemory(5), 2 * runsPerCandidate);
+    ASSERT_EQ(cache->size(), 1U);
+
+    // the same bucket of activations is served from the cache
+    for (const size_t rows : {6, 7, 8}) {
+        ASSERT_TRUE(executor->update(makeMemory(rows)));
+        ASSERT_NE(executor->tuningInfo().find("(cached)"), std::string::npos) << executor->tuningInfo();
+    }
+    ASSERT_EQ(cache->size(), 1U);
+
+    // the weights dims are exact, 31 and 32 would share a bucket
+    ASSERT_TRUE(executor->update(makeMemory(8, 16, 31)));
+    ASSERT_EQ(executor->tuningInfo(), "");
+    run(*executor, makeMemory(8, 16, 31), 2 * runsPerCandidate);
+    ASSERT_EQ(cache->size(), 2U);
+}
+
+TEST_F(TunedExecutorTest, CachedChoiceIsSharedBetweenExecutors) {
+    addImplementation("slow", std::chrono::microseconds(2000));
+    addImplementation("fast", std::chrono::microseconds(0));
+    auto cache = std::make_shared<ExecutorTuningCache>();
+    const auto memory = makeMemory(3);
+
+    auto first = makeExecutor(cache);
+    ASSERT_TRUE(first->update(memory));
+    run(*first, memory, 2 * runsPerCandidate);
+    first.reset();
+    m_stats = {};
+
+    // e.g. the same layer in another stream or in the imported model
+    auto restored = std::make_shared<ExecutorTuningCache>();
+    restored->deserialize(cache->serialize());
+    auto second = makeExecutor(restored);
+    ASSERT_TRUE(second->update(memory));
+    ASSERT_EQ(second->tuningInfo(), "fast (cached)");
+    ASSERT_EQ(m_stats.created.size(), 1U);
+    ASSERT_EQ(m_stats.created["fast"], 1U);
+}
+
+TEST_F(TunedExecutorTest, SingleAcceptingImplementationIsNotMeasured) {
+    addImplementation("small", std::chrono::microseconds(0), 4);
+    addImplementation("any", std::chrono::microseconds(0));
+    auto cache = std::make_shared<ExecutorTuningCache>();
+    auto executor = makeExecutor(cache);
+
+    ASSERT_TRUE(executor->update(makeMemory(16)));
+    ASSERT_EQ(executor->tuningInfo(), "any");
+    run(*executor, makeMemory(16), 2 * runsPerCandidate);
+    ASSERT_EQ(cache->size(), 0U);
+    ASSERT_EQ(m_stats.created.count("small"), 0U);
+}
+
+TEST(ExecutorTuningCacheTest, SerializationRoundTrip) {
+    ExecutorTuningCache cache;
+    cache.insert("0;a,b,;1:f32:4x32x", "a");
+    cache.insert("0;a,b,;1:f32:8x32x", "b");
+
+    ExecutorTuningCache restored;
+    restored.deserialize(cache.serialize() + "malformed|=x|y=|");
+    ASSERT_EQ(restored.size(), 2U);
+    ASSERT_EQ(restored.find("0;a,b,;1:f32:4x32x").value_or(""), "a");
+    ASSERT_EQ(restored.find("0;a,b,;1:f32:8x32x").value_or(""), "b");
+    ASSERT_EQ(restored.serialize(), cache.serialize());
+}
+
+}  // namespace
@@ -121,6 +121,10 @@ class MHATransposedB : public MHA {
     std::shared_ptr<SnippetsFunctionBase> get_subgraph() const override;
 };
 
+class MHARoPE : public MHA {
+    std::shared_ptr<SnippetsFunctionBase> get_subgraph() const override;
+};
+
 class MHAINT8MatMul : public MHA {
 protected:
     std::shared_ptr<SnippetsFunctionBase> get_subgraph() const override;
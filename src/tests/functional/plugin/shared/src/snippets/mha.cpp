@@ -307,6 +307,10 @@ std::shared_ptr<SnippetsFunctionBase> MHAWOTranspose::get_subgraph() const {
     return std::make_shared<ov::test::snippets::MHAWOTransposeFunction>(inputDynamicShapes, m_input_types);
 }
 
+std::shared_ptr<SnippetsFunctionBase> MHARoPE::get_subgraph() const {
+    return std::make_shared<ov::test::snippets::MHARoPEFunction>(inputDynamicShapes);
+}
+
 std::shared_ptr<SnippetsFunctionBase> MHAINT8MatMul::get_subgraph() const {
     return std::make_shared<ov::test::snippets::MHAINT8MatMulFunction>(inputDynamicShapes);
 }
@@ -405,6 +409,12 @@ TEST_P(MHAWOTranspose, CompareWithRefImpl) {
     validateNumSubgraphs();
 }
 
+TEST_P(MHARoPE, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    validateNumSubgraphs();
+}
+
 TEST_P(MHAMulAdd, CompareWithRefImpl) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     run();
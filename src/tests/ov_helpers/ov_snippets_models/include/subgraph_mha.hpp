@@ -577,6 +577,39 @@ protected:
     const std::vector<ov::element::Type> precisions;
 };
 
+/* Graph:
+ *                   q
+ *                   |
+ *            rotate_half(q)
+ *     q  cos        |       sin
+ *      \ /          |      /
+ *    Multiply      Multiply
+ *           \      /
+ *              Add    k
+ *                \   /
+ *               MatMul0
+ *                 |
+ *              Softmax
+ *                  \     v
+ *                   \   /
+ *                  MatMul1
+ * Note: This is a MHA pattern with elementwise part of rotary positional embeddings on Queries.
+ *       rotate_half(q) is VariadicSplit of q by the last axis and Concat of the halves in reverse order.
+ *       Inputs: q, cos, sin, k, v
+ */
+class MHARoPEFunction : public SnippetsFunctionBase {
+public:
+    explicit MHARoPEFunction(const std::vector<PartialShape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        OPENVINO_ASSERT(input_shapes.size() == 5, "Got invalid number of input shapes");
+        OPENVINO_ASSERT(input_shapes[0].rank().is_static() && input_shapes[0].rbegin()->is_static(),
+                        "Head size of Queries must be static");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+};
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
@@ -1286,6 +1286,66 @@ std::shared_ptr<ov::Model> MHASharedKVFunction::initOriginal() const {
     return std::make_shared<ov::Model>(results, ov::ParameterVector{param0, param1}, "mha_shared_kv");
 }
 
+namespace {
+// rotate_half(x): the halves of x along the last axis are swapped, the sign is expected to be in the sin table
+std::shared_ptr<ov::Node> make_rotate_half(const ov::Output<ov::Node>& x) {
+    const auto head_size = x.get_partial_shape().rbegin()->get_length();
+    const auto axis = ov::opset1::Constant::create(ov::element::i64, ov::Shape{}, {-1});
+    const auto lengths = ov::opset1::Constant::create(ov::element::i64, ov::Shape{2}, {head_size / 2, head_size / 2});
+    const auto split = std::make_shared<ov::opset1::VariadicSplit>(x, axis, lengths);
+    return std::make_shared<ov::opset1::Concat>(ov::OutputVector{split->output(1), split->output(0)}, -1);
+}
+}  // namespace
+
+std::shared_ptr<ov::Model> MHARoPEFunction::initOriginal() const {
+    ov::ParameterVector parameters;
+    for (const auto& shape : input_shapes) {
+        parameters.push_back(std::make_shared<ov::opset1::Parameter>(precision, shape));
+    }
+    const auto mul_cos = std::make_shared<ov::opset1::Multiply>(parameters[0], parameters[1]);
+    const auto mul_sin = std::make_shared<ov::opset1::Multiply>(make_rotate_half(parameters[0]), parameters[2]);
+    const auto rope = std::make_shared<ov::opset1::Add>(mul_cos, mul_sin);
+    const auto matmul_0 = std::make_shared<ov::op::v0::MatMul>(rope, parameters[3]);
+    const auto softmax = std::make_shared<ov::op::v8::Softmax>(matmul_0, -1);
+    const auto matmul_1 = std::make_shared<ov::op::v0::MatMul>(softmax, parameters[4]);
+    ov::ResultVector results{std::make_shared<ov::opset1::Result>(matmul_1)};
+    return std::make_shared<ov::Model>(results, parameters, "mha_rope");
+}
+
+std::shared_ptr<ov::Model> MHARoPEFunction::initReference() const {
+    ov::ParameterVector parameters;
+    for (const auto& shape : input_shapes) {
+        parameters.push_back(std::make_shared<ov::opset1::Parameter>(precision, shape));
+    }
+    // The rotation stays outside of the Subgraph.
+    // Subgraph inputs follow the topological order of tokenized ops: q, cos, rotate_half(q), sin, k, v
+    const auto rotated = make_rotate_half(parameters[0]);
+    const ov::OutputVector subgraph_inputs{parameters[0],
+                                           parameters[1],
+                                           rotated,
+                                           parameters[2],
+                                           parameters[3],
+                                           parameters[4]};
+    ov::ParameterVector subgraph_params;
+    for (const auto& input : subgraph_inputs) {
+        subgraph_params.push_back(std::make_shared<ov::opset1::Parameter>(precision, input.get_partial_shape()));
+    }
+
+    const auto mul_cos = std::make_shared<ov::opset1::Multiply>(subgraph_params[0], subgraph_params[1]);
+    const auto mul_sin = std::make_shared<ov::opset1::Multiply>(subgraph_params[2], subgraph_params[3]);
+    const auto rope = std::make_shared<ov::opset1::Add>(mul_cos, mul_sin);
+    const auto matmul_0 = std::make_shared<ov::op::v0::MatMul>(rope, subgraph_params[4]);
+    const auto softmax = std::make_shared<ov::op::v8::Softmax>(matmul_0, -1);
+    const auto matmul_1 = std::make_shared<ov::op::v0::MatMul>(softmax, subgraph_params[5]);
+    const auto snippets_result = std::make_shared<ov::snippets::op::Result>(matmul_1);
+
+    const auto subgraph = std::make_shared<ov::snippets::op::Subgraph>(
+        subgraph_inputs,
+        std::make_shared<ov::Model>(OutputVector{snippets_result}, subgraph_params));
+    ov::ResultVector results{std::make_shared<ov::opset1::Result>(subgraph)};
+    return std::make_shared<ov::Model>(results, parameters, "mha_rope");
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
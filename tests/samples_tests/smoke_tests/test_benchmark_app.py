@@ -453,3 +453,53 @@ def test_benchmark_app_no_warmup_with_api_modes(sample_language, device, api, ca
     assert 'FPS' in output
     assert 'Skipping warmup inference due to -no_warmup flag' in output
     assert 'First inference took' not in output
+
+
+def run_open_loop(device, cache, tmp_path, *args):
+    output = get_cmd_output(
+        get_executable('C++'),
+        *prepend(cache, 'dog-224x224.bmp', 'bvlcalexnet-12.onnx', tmp_path),
+        '-d', device,
+        '-nireq', '2',
+        '-niter', '8',
+        '-json_stats',
+        '-report_type', 'no_counters',
+        '-report_folder', tmp_path,
+        *args
+    )
+    assert 'FPS' in output
+    with (tmp_path / 'benchmark_report.json').open(encoding='utf-8') as file:
+        results = json.load(file)['execution_results']
+    # the total iterations cover all the measured arrival rates
+    points = results['open_loop_results']
+    assert results['iterations_num'] == sum(point['requests'] for point in points)
+    for point in points:
+        assert point['requests'] == 8
+        assert point['latency_p50'] <= point['latency_p99'] <= point['latency_max']
+        assert sum(bucket['count'] for bucket in point['latency_histogram']) == point['requests']
+    return output, results
+
+
+@pytest.mark.parametrize('device', get_devices())
+def test_open_loop_constant_arrival(device, cache, tmp_path):
+    """Test -arrival constant: the requests are started at the given rate and reported as a single open-loop point."""
+    output, results = run_open_loop(device, cache, tmp_path, '-arrival', 'constant', '-arrival_rate', '50')
+    assert output.count('Arrival rate ') == 1
+    assert len(results['open_loop_results']) == 1
+    assert results['open_loop_results'][0]['arrival'] == 'constant'
+    assert results['open_loop_results'][0]['target_rate'] == 50
+
+
+@pytest.mark.parametrize('device', get_devices())
+def test_open_loop_rate_sweep(device, cache, tmp_path):
+    """Test -rate_sweep: every measured arrival rate is reported and the max rate meeting the SLO is among them."""
+    output, results = run_open_loop(device, cache, tmp_path, '-arrival', 'constant', '-arrival_rate', '50',
+                                    '-latency_slo', '100000', '-rate_sweep')
+    points = results['open_loop_results']
+    assert len(points) > 1
+    assert output.count('Arrival rate ') == len(points)
+    # the SLO is never violated, so the sweep doubles the rate at every step
+    assert all(point['slo_met'] for point in points)
+    assert [point['target_rate'] for point in points] == [50 * 2 ** i for i in range(len(points))]
+    assert results['slo_max_arrival_rate'] == points[-1]['target_rate']
+    assert 'Max arrival rate meeting p99 latency SLO' in output